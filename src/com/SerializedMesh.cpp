@@ -111,18 +111,14 @@ void SerializedMesh::addToMesh(mesh::Mesh &mesh) const
   const auto dim = mesh.getDimensions();
 
   std::map<int, mesh::Vertex *> vertices;
-  {
-    Eigen::VectorXd coord(dim);
-    for (std::size_t i = 0; i < static_cast<std::size_t>(numberOfVertices); ++i) {
-      std::copy_n(&coords[i * dim], dim, coord.data());
-      mesh::Vertex &v = mesh.createVertex(coord);
-
-      if (hasConnectivity) {
-        v.setGlobalIndex(ids[i * 2]);
-        vertices.emplace(ids[i * 2 + 1], &v);
-      } else {
-        v.setGlobalIndex(ids[i]);
-      }
+  for (std::size_t i = 0; i < static_cast<std::size_t>(numberOfVertices); ++i) {
+    mesh::Vertex &v = mesh.createVertex(Eigen::Map<const Eigen::VectorXd>(&coords[i * dim], dim));
+
+    if (hasConnectivity) {
+      v.setGlobalIndex(ids[i * 2]);
+      vertices.emplace(ids[i * 2 + 1], &v);
+    } else {
+      v.setGlobalIndex(ids[i]);
     }
   }
 
@@ -180,8 +176,6 @@ SerializedMesh SerializedMesh::serialize(const mesh::Mesh &mesh)
     return result;
   }
 
-  auto dim = static_cast<size_t>(mesh.getDimensions());
-
   // we always need to send globalIDs
   auto       totalIDs        = numberOfVertices;
   const bool hasConnectivity = mesh.hasConnectivity();
@@ -193,14 +187,15 @@ SerializedMesh SerializedMesh::serialize(const mesh::Mesh &mesh)
   }
   result.ids.reserve(totalIDs);
 
-  result.coords.resize(numberOfVertices * dim);
+  // The vertex arrays of the mesh store the coordinates contiguously in the serialized layout
+  const auto coordinates   = mesh.vertexCoordinates();
+  const auto globalIndices = mesh.vertexGlobalIndices();
+  result.coords.assign(coordinates.data(), coordinates.data() + coordinates.size());
   for (size_t i = 0; i < numberOfVertices; ++i) {
-    auto &v = meshVertices[i];
-    std::copy_n(v.rawCoords().begin(), dim, &result.coords[i * dim]);
-    result.ids.push_back(v.getGlobalIndex());
+    result.ids.push_back(globalIndices(i));
     // local ids are only interleaved if required
     if (hasConnectivity) {
-      result.ids.push_back(v.getID());
+      result.ids.push_back(meshVertices[i].getID());
     }
   }
 
@@ -72,8 +72,9 @@ void ExportVTK::exportMesh(
 
   // Plot vertices
   outFile << "POINTS " << mesh.nVertices() << " double \n\n";
-  for (const mesh::Vertex &vertex : mesh.vertices()) {
-    writeVertex(vertex.getCoords(), outFile);
+  const auto coordinates = mesh.vertexCoordinates();
+  for (Eigen::Index i = 0; i < coordinates.cols(); ++i) {
+    writeVertex(coordinates.col(i), outFile);
   }
   outFile << '\n';
 
@@ -270,8 +271,8 @@ void ExportVTK::writeHeader(
 }
 
 void ExportVTK::writeVertex(
-    const Eigen::VectorXd &position,
-    std::ostream &         outFile)
+    const Eigen::Ref<const Eigen::VectorXd> &position,
+    std::ostream &                          outFile)
 {
   if (position.size() == 2) {
     outFile << position(0) << "  " << position(1) << "  " << 0.0 << '\n';
@@ -38,8 +38,8 @@ public:
   static void writeHeader(std::ostream &outFile);
 
   static void writeVertex(
-      const Eigen::VectorXd &position,
-      std::ostream &         outFile);
+      const Eigen::Ref<const Eigen::VectorXd> &position,
+      std::ostream &                          outFile);
 
   static void writeLine(
       int           vertexIndices[2],
@@ -284,8 +284,8 @@ void ExportXML::exportData(
 }
 
 void ExportXML::writeVertex(
-    const Eigen::VectorXd &position,
-    std::ostream &         outFile)
+    const Eigen::Ref<const Eigen::VectorXd> &position,
+    std::ostream &                          outFile)
 {
   outFile << "               ";
   for (int i = 0; i < position.size(); i++) {
@@ -330,8 +330,9 @@ void ExportXML::exportPoints(
 {
   outFile << "         <Points> \n";
   outFile << "            <DataArray type=\"Float64\" Name=\"Position\" NumberOfComponents=\"" << 3 << "\" format=\"ascii\"> \n";
-  for (const mesh::Vertex &vertex : mesh.vertices()) {
-    writeVertex(vertex.getCoords(), outFile);
+  const auto coordinates = mesh.vertexCoordinates();
+  for (Eigen::Index i = 0; i < coordinates.cols(); ++i) {
+    writeVertex(coordinates.col(i), outFile);
   }
   outFile << "            </DataArray>\n";
   outFile << "         </Points> \n\n";
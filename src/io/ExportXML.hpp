@@ -37,8 +37,8 @@ public:
   void exportSeries() const final override;
 
   static void writeVertex(
-      const Eigen::VectorXd &position,
-      std::ostream &         outFile);
+      const Eigen::Ref<const Eigen::VectorXd> &position,
+      std::ostream &                          outFile);
 
   static void writeLine(
       const mesh::Edge &edge,
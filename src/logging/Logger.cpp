@@ -5,6 +5,7 @@
 #include <boost/log/sources/severity_feature.hpp>
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/common_attributes.hpp>
+#include <map>
 #include <utility>
 #include <utils/assertion.hpp>
 
@@ -104,10 +105,14 @@ public:
    * @param[in] module the name of the module.
    */
   explicit LoggerImpl(std::string_view module);
+
+  /// The name of the module, which is constant and may be read concurrently
+  const std::string module;
 };
 
 /// Registers attributes that don't depend on the \ref LogLocation
 Logger::LoggerImpl::LoggerImpl(std::string_view module)
+    : module(module)
 {
   namespace attrs = boost::log::attributes;
 
@@ -156,6 +161,9 @@ void Logger::swap(Logger &other) noexcept
 
 void Logger::error(LogLocation loc, std::string_view mess) noexcept
 {
+  if (defer(boost::log::trivial::severity_level::error, loc, mess)) {
+    return;
+  }
   try {
     PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::error, loc) << mess;
   } catch (...) {
@@ -164,6 +172,9 @@ void Logger::error(LogLocation loc, std::string_view mess) noexcept
 
 void Logger::warning(LogLocation loc, std::string_view mess) noexcept
 {
+  if (defer(boost::log::trivial::severity_level::warning, loc, mess)) {
+    return;
+  }
   try {
     PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::warning, loc) << mess;
   } catch (...) {
@@ -172,6 +183,9 @@ void Logger::warning(LogLocation loc, std::string_view mess) noexcept
 
 void Logger::info(LogLocation loc, std::string_view mess) noexcept
 {
+  if (defer(boost::log::trivial::severity_level::info, loc, mess)) {
+    return;
+  }
   try {
     PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::info, loc) << mess;
   } catch (...) {
@@ -180,6 +194,9 @@ void Logger::info(LogLocation loc, std::string_view mess) noexcept
 
 void Logger::debug(LogLocation loc, std::string_view mess) noexcept
 {
+  if (defer(boost::log::trivial::severity_level::debug, loc, mess)) {
+    return;
+  }
   try {
     PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::debug, loc) << mess;
   } catch (...) {
@@ -188,12 +205,59 @@ void Logger::debug(LogLocation loc, std::string_view mess) noexcept
 
 void Logger::trace(LogLocation loc, std::string_view mess) noexcept
 {
+  if (defer(boost::log::trivial::severity_level::trace, loc, mess)) {
+    return;
+  }
   try {
     PRECICE_LOG_IMPL(*_impl, boost::log::trivial::severity_level::trace, loc) << mess;
   } catch (...) {
   }
 }
 
+namespace {
+/// The records deferred by the calling thread, nullptr if the thread logs directly
+thread_local std::vector<DeferredRecord> *deferredRecords = nullptr;
+} // namespace
+
+bool Logger::defer(int severity, LogLocation loc, std::string_view mess) const noexcept
+{
+  if (deferredRecords == nullptr) {
+    return false;
+  }
+  try {
+    deferredRecords->push_back(DeferredRecord{_impl->module, severity, loc, std::string{mess}});
+  } catch (...) {
+  }
+  return true;
+}
+
+DeferLogging::DeferLogging(std::vector<DeferredRecord> &records)
+    : _previous(deferredRecords)
+{
+  deferredRecords = &records;
+}
+
+DeferLogging::~DeferLogging()
+{
+  deferredRecords = _previous;
+}
+
+void emitDeferred(std::vector<DeferredRecord> &records) noexcept
+{
+  try {
+    std::map<std::string, Logger> loggers;
+    for (const auto &record : records) {
+      auto &log = loggers.try_emplace(record.module, record.module).first->second;
+      // Records emitted by a thread, which defers its own records, are passed on
+      if (!log.defer(record.severity, record.location, record.message)) {
+        PRECICE_LOG_IMPL(*log._impl, static_cast<boost::log::trivial::severity_level>(record.severity), record.location) << record.message;
+      }
+    }
+  } catch (...) {
+  }
+  records.clear();
+}
+
 #undef PRECICE_LOG_IMPL
 
 } // namespace precice::logging
@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace precice::logging {
 
@@ -13,6 +14,8 @@ struct LogLocation {
   const char *func;
 };
 
+struct DeferredRecord;
+
 /// This class provides a lightweight logger.
 class Logger {
 public:
@@ -43,8 +46,42 @@ private:
 
   /// Pimpl to the logger implementation
   std::unique_ptr<LoggerImpl> _impl;
+
+  /// Appends the record to the deferred records of the calling thread, returns false if the thread doesn't defer its records
+  bool defer(int severity, LogLocation loc, std::string_view mess) const noexcept;
+
+  friend void emitDeferred(std::vector<DeferredRecord> &records) noexcept;
+};
+
+/// A log record of a thread, which defers its records to be emitted by another thread
+struct DeferredRecord {
+  std::string module;
+  int         severity;
+  LogLocation location;
+  std::string message;
+};
+
+/**
+ * @brief Defers the log records of the calling thread while in scope
+ *
+ * Loggers are not thread-safe. Threads working concurrently to the thread that spawned them, hence,
+ * collect their log records, which the spawning thread emits after joining them using emitDeferred().
+ */
+class DeferLogging {
+public:
+  explicit DeferLogging(std::vector<DeferredRecord> &records);
+  ~DeferLogging();
+
+  DeferLogging(const DeferLogging &) = delete;
+  DeferLogging &operator=(const DeferLogging &) = delete;
+
+private:
+  std::vector<DeferredRecord> *_previous;
 };
 
+/// Emits and clears the given records on the calling thread in their original order
+void emitDeferred(std::vector<DeferredRecord> &records) noexcept;
+
 /// Utility function to log an error and throw an exception of given type
 template <class Error>
 inline void logErrorAndThrow [[noreturn]] (precice::logging::Logger &log, precice::logging::LogLocation location, const std::string &message)
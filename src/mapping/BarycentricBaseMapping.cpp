@@ -1,5 +1,6 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <ostream>
 #include <unordered_set>
@@ -9,6 +10,7 @@
 #include "mapping/BarycentricBaseMapping.hpp"
 #include "mapping/Mapping.hpp"
 #include "mapping/Polation.hpp"
+#include "mapping/impl/OperatorCache.hpp"
 #include "math/differences.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
@@ -22,6 +24,87 @@
 
 namespace precice::mapping {
 
+namespace {
+
+using Offsets = std::vector<std::size_t>;
+
+/**
+ * @brief Computes out += A * in for all given samples in a single sweep over the CSR operator A
+ *
+ * Each row of A computes the values of one output vertex as linear combination of input vertices.
+ * All components of a vertex are processed at once, which allows to vectorize fixed component counts.
+ */
+template <int Dims>
+void multiply(const Offsets &offsets, const std::vector<int> &columns, const std::vector<double> &weights, int dims, std::size_t nColumns,
+              const std::vector<const double *> &in, const std::vector<double *> &out)
+{
+  using Block = Eigen::Matrix<double, Dims, 1>;
+
+  const std::size_t rows = offsets.size() - 1;
+  for (std::size_t row = 0; row < rows; ++row) {
+    PRECICE_ASSERT(offsets[row] <= offsets[row + 1], row, offsets[row], offsets[row + 1]);
+    for (std::size_t s = 0; s < in.size(); ++s) {
+      Block sum = Block::Zero(dims);
+      for (std::size_t k = offsets[row]; k < offsets[row + 1]; ++k) {
+        PRECICE_ASSERT(columns[k] >= 0 && static_cast<std::size_t>(columns[k]) < nColumns, row, columns[k], nColumns);
+        sum += weights[k] * Eigen::Map<const Block>(in[s] + static_cast<std::size_t>(columns[k]) * dims, dims);
+      }
+      Eigen::Map<Block>(out[s] + row * dims, dims) += sum;
+    }
+  }
+}
+
+/**
+ * @brief Computes out += A^T * in for all given samples in a single sweep over the CSR operator A
+ *
+ * Each row of A distributes the values of one input vertex among output vertices.
+ */
+template <int Dims>
+void multiplyTransposed(const Offsets &offsets, const std::vector<int> &columns, const std::vector<double> &weights, int dims, std::size_t nColumns,
+                        const std::vector<const double *> &in, const std::vector<double *> &out)
+{
+  using Block = Eigen::Matrix<double, Dims, 1>;
+
+  const std::size_t rows = offsets.size() - 1;
+  for (std::size_t row = 0; row < rows; ++row) {
+    PRECICE_ASSERT(offsets[row] <= offsets[row + 1], row, offsets[row], offsets[row + 1]);
+    for (std::size_t s = 0; s < in.size(); ++s) {
+      const Eigen::Map<const Block> value(in[s] + row * dims, dims);
+      for (std::size_t k = offsets[row]; k < offsets[row + 1]; ++k) {
+        PRECICE_ASSERT(columns[k] >= 0 && static_cast<std::size_t>(columns[k]) < nColumns, row, columns[k], nColumns);
+        Eigen::Map<Block>(out[s] + static_cast<std::size_t>(columns[k]) * dims, dims) += weights[k] * value;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Dispatches to the kernel specialized for the component count
+ *
+ * @param[in] nColumns the number of vertices the column indices of the operator refer to
+ */
+void multiplyOperator(const Offsets &offsets, const std::vector<int> &columns, const std::vector<double> &weights, int dims, std::size_t nColumns, bool transposed,
+                      const std::vector<const double *> &in, const std::vector<double *> &out)
+{
+  PRECICE_ASSERT(!offsets.empty() && offsets.front() == 0, offsets.size());
+  PRECICE_ASSERT(offsets.back() == columns.size(), offsets.back(), columns.size());
+  PRECICE_ASSERT(columns.size() == weights.size(), columns.size(), weights.size());
+  PRECICE_ASSERT(in.size() == out.size(), in.size(), out.size());
+
+  switch (dims) {
+  case 1:
+    return transposed ? multiplyTransposed<1>(offsets, columns, weights, dims, nColumns, in, out) : multiply<1>(offsets, columns, weights, dims, nColumns, in, out);
+  case 2:
+    return transposed ? multiplyTransposed<2>(offsets, columns, weights, dims, nColumns, in, out) : multiply<2>(offsets, columns, weights, dims, nColumns, in, out);
+  case 3:
+    return transposed ? multiplyTransposed<3>(offsets, columns, weights, dims, nColumns, in, out) : multiply<3>(offsets, columns, weights, dims, nColumns, in, out);
+  default:
+    return transposed ? multiplyTransposed<Eigen::Dynamic>(offsets, columns, weights, dims, nColumns, in, out) : multiply<Eigen::Dynamic>(offsets, columns, weights, dims, nColumns, in, out);
+  }
+}
+
+} // namespace
+
 BarycentricBaseMapping::BarycentricBaseMapping(Constraint constraint, int dimensions)
     : Mapping(constraint, dimensions, false, Mapping::InitialGuessRequirement::None)
 {
@@ -30,36 +113,84 @@ BarycentricBaseMapping::BarycentricBaseMapping(Constraint constraint, int dimens
 void BarycentricBaseMapping::clear()
 {
   PRECICE_TRACE();
-  _interpolations.clear();
+  _rowOffsets.clear();
+  _columns.clear();
+  _weights.clear();
   _hasComputedMapping = false;
 }
 
+std::vector<double> BarycentricBaseMapping::computeOperator(const mesh::Mesh &origins, const BatchQuery &query)
+{
+  PRECICE_TRACE(origins.getName());
+  clear();
+
+  const std::size_t rows = origins.nVertices();
+
+  const auto matches = query(origins.vertexCoordinates());
+  PRECICE_ASSERT(matches.size() == rows, matches.size(), rows);
+
+  _rowOffsets.assign(rows + 1, 0);
+  for (std::size_t row = 0; row < rows; ++row) {
+    _rowOffsets[row + 1] = _rowOffsets[row] + matches[row].polation.getWeightedElements().size();
+  }
+
+  _columns.resize(_rowOffsets.back());
+  _weights.resize(_rowOffsets.back());
+  std::vector<double> distances(rows);
+  for (std::size_t row = 0; row < rows; ++row) {
+    const auto &elements = matches[row].polation.getWeightedElements();
+    for (std::size_t k = 0; k < elements.size(); ++k) {
+      _columns[_rowOffsets[row] + k] = elements[k].vertexID;
+      _weights[_rowOffsets[row] + k] = elements[k].weight;
+    }
+    distances[row] = matches[row].polation.distance();
+  }
+
+  return distances;
+}
+
+std::size_t BarycentricBaseMapping::operatorRows() const
+{
+  return _rowOffsets.empty() ? 0 : _rowOffsets.size() - 1;
+}
+
+bool BarycentricBaseMapping::loadOperator(const CacheEntry &cache, std::size_t rows, std::size_t columns)
+{
+  clear();
+  if (!impl::OperatorCache::read(cache.file, cache.key, _rowOffsets, _columns, _weights)) {
+    clear();
+    return false;
+  }
+
+  // Reject operators which don't fit the current meshes
+  const bool valid = _rowOffsets.size() == rows + 1 && _rowOffsets.front() == 0 &&
+                     std::is_sorted(_rowOffsets.begin(), _rowOffsets.end()) &&
+                     _rowOffsets.back() == _columns.size() && _columns.size() == _weights.size() &&
+                     std::all_of(_columns.begin(), _columns.end(), [columns](int column) { return column >= 0 && static_cast<std::size_t>(column) < columns; });
+  if (!valid) {
+    clear();
+  }
+  return valid;
+}
+
+bool BarycentricBaseMapping::storeOperator(const CacheEntry &cache) const
+{
+  return impl::OperatorCache::write(cache.file, cache.key, _rowOffsets, _columns, _weights);
+}
+
 void BarycentricBaseMapping::mapConservative(const time::Sample &inData, Eigen::VectorXd &outData)
 {
   PRECICE_TRACE();
   precice::profiling::Event e("map.bbm.mapData.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
   PRECICE_ASSERT(getConstraint() == CONSERVATIVE);
   PRECICE_DEBUG("Map conservative using {}", getName());
-  PRECICE_ASSERT(_interpolations.size() == input()->nVertices(),
-                 _interpolations.size(), input()->nVertices());
-  const int              dimensions = inData.dataDims;
-  const Eigen::VectorXd &inValues   = inData.values;
-  Eigen::VectorXd &      outValues  = outData;
+  PRECICE_ASSERT(operatorRows() == input()->nVertices(),
+                 operatorRows(), input()->nVertices());
+  PRECICE_ASSERT(outData.size() == static_cast<Eigen::Index>(inData.dataDims * output()->nVertices()));
 
   // For each input vertex, distribute the conserved data among the relevant output vertices
   // Do it for all dimensions (i.e. components if data is a vector)
-  for (size_t i = 0; i < input()->nVertices(); i++) {
-    const size_t inOffset = i * dimensions;
-    const auto & elems    = _interpolations[i].getWeightedElements();
-    for (const auto &elem : elems) {
-      size_t outOffset = static_cast<size_t>(elem.vertexID) * dimensions;
-      for (int dim = 0; dim < dimensions; dim++) {
-        PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-        PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-        outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-      }
-    }
-  }
+  multiplyOperator(_rowOffsets, _columns, _weights, inData.dataDims, output()->nVertices(), true, {inData.values.data()}, {outData.data()});
 }
 
 void BarycentricBaseMapping::mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData)
@@ -67,27 +198,58 @@ void BarycentricBaseMapping::mapConsistent(const time::Sample &inData, Eigen::Ve
   PRECICE_TRACE();
   precice::profiling::Event e("map.bbm.mapData.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
   PRECICE_DEBUG("Map {} using {}", (hasConstraint(CONSISTENT) ? "consistent" : "scaled-consistent"), getName());
-  PRECICE_ASSERT(_interpolations.size() == output()->nVertices(),
-                 _interpolations.size(), output()->nVertices());
-
-  const int              dimensions = inData.dataDims;
-  const Eigen::VectorXd &inValues   = inData.values;
-  Eigen::VectorXd &      outValues  = outData;
+  PRECICE_ASSERT(operatorRows() == output()->nVertices(),
+                 operatorRows(), output()->nVertices());
+  PRECICE_ASSERT(outData.size() == static_cast<Eigen::Index>(inData.dataDims * output()->nVertices()));
 
   // For each output vertex, compute the linear combination of input vertices
   // Do it for all dimensions (i.e. components if data is a vector)
-  for (size_t i = 0; i < output()->nVertices(); i++) {
-    const auto &elems     = _interpolations[i].getWeightedElements();
-    size_t      outOffset = i * dimensions;
-    for (const auto &elem : elems) {
-      const size_t inOffset = static_cast<size_t>(elem.vertexID) * dimensions;
-      for (int dim = 0; dim < dimensions; dim++) {
-        PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-        PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-        outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-      }
-    }
+  multiplyOperator(_rowOffsets, _columns, _weights, inData.dataDims, input()->nVertices(), false, {inData.values.data()}, {outData.data()});
+}
+
+void BarycentricBaseMapping::mapConservativeBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData)
+{
+  PRECICE_TRACE();
+  precice::profiling::Event e("map.bbm.mapData.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
+  PRECICE_ASSERT(getConstraint() == CONSERVATIVE);
+  PRECICE_DEBUG("Map conservative using {} for {} samples", getName(), inData.size());
+  PRECICE_ASSERT(operatorRows() == input()->nVertices(),
+                 operatorRows(), input()->nVertices());
+  const int dimensions = inData.front()->dataDims;
+  PRECICE_ASSERT(outData.rows() == static_cast<Eigen::Index>(dimensions * output()->nVertices()));
+  PRECICE_ASSERT(outData.cols() == static_cast<Eigen::Index>(inData.size()));
+
+  std::vector<const double *> in;
+  std::vector<double *>       out;
+  for (std::size_t s = 0; s < inData.size(); ++s) {
+    in.push_back(inData[s]->values.data());
+    out.push_back(outData.col(s).data());
   }
+
+  // Traverse the operator once and distribute the conserved data of all samples
+  multiplyOperator(_rowOffsets, _columns, _weights, dimensions, output()->nVertices(), true, in, out);
+}
+
+void BarycentricBaseMapping::mapConsistentBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData)
+{
+  PRECICE_TRACE();
+  precice::profiling::Event e("map.bbm.mapData.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
+  PRECICE_DEBUG("Map {} using {} for {} samples", (hasConstraint(CONSISTENT) ? "consistent" : "scaled-consistent"), getName(), inData.size());
+  PRECICE_ASSERT(operatorRows() == output()->nVertices(),
+                 operatorRows(), output()->nVertices());
+  const int dimensions = inData.front()->dataDims;
+  PRECICE_ASSERT(outData.rows() == static_cast<Eigen::Index>(dimensions * output()->nVertices()));
+  PRECICE_ASSERT(outData.cols() == static_cast<Eigen::Index>(inData.size()));
+
+  std::vector<const double *> in;
+  std::vector<double *>       out;
+  for (std::size_t s = 0; s < inData.size(); ++s) {
+    in.push_back(inData[s]->values.data());
+    out.push_back(outData.col(s).data());
+  }
+
+  // Traverse the operator once and compute the linear combinations for all samples
+  multiplyOperator(_rowOffsets, _columns, _weights, dimensions, input()->nVertices(), false, in, out);
 }
 
 void BarycentricBaseMapping::tagMeshFirstRound()
@@ -96,7 +258,10 @@ void BarycentricBaseMapping::tagMeshFirstRound()
   precice::profiling::Event e("map.bbm.tagMeshFirstRound.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
   PRECICE_DEBUG("Compute Mapping for Tagging");
 
+  // The mapping on the unfiltered meshes is temporary and must not be cached
+  suspendCache(true);
   computeMapping();
+  suspendCache(false);
   PRECICE_DEBUG("Tagging First Round");
 
   // Determine the Mesh to Tag
@@ -112,10 +277,10 @@ void BarycentricBaseMapping::tagMeshFirstRound()
   std::unordered_set<int> tagged;
   const std::size_t       max_count = origins->nVertices();
 
-  for (const Polation &interpolation : _interpolations) {
-    for (const auto &elem : interpolation.getWeightedElements()) {
-      if (!math::equals(elem.weight, 0.0)) {
-        tagged.insert(elem.vertexID);
+  for (std::size_t row = 0; row < operatorRows(); ++row) {
+    for (std::size_t k = _rowOffsets[row]; k < _rowOffsets[row + 1]; ++k) {
+      if (!math::equals(_weights[k], 0.0)) {
+        tagged.insert(_columns[k]);
       }
     }
     // Shortcut if all vertices are tagged
@@ -1,16 +1,24 @@
 #pragma once
 
+#include <Eigen/Core>
+#include <cstddef>
+#include <functional>
+#include <string>
 #include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
 #include "mapping/Polation.hpp"
+#include "query/Index.hpp"
 
 namespace precice {
 namespace mapping {
 
 /**
  * @brief Base class for interpolation based mappings, where mapping is done using a geometry-based linear combination of input values.
- *  Subclasses differ by the way computeMapping() fills the _interpolations and by mesh tagging. Mapping itself is shared.
+ *  Subclasses differ by the way computeMapping() fills the mapping operator and by mesh tagging. Mapping itself is shared.
+ *
+ * The operator is stored in compressed sparse row (CSR) format, where each row holds the weights of one origin vertex,
+ * i.e., an output vertex for consistent mappings and an input vertex for conservative mappings.
  */
 class BarycentricBaseMapping : public Mapping {
 public:
@@ -26,13 +34,59 @@ private:
   logging::Logger _log{"mapping::BarycentricBaseMapping"};
 
 protected:
+  /// Computes the projections of the columns of a dims x n location matrix
+  using BatchQuery = std::function<std::vector<query::ProjectionMatch>(const Eigen::Ref<const Eigen::MatrixXd> &)>;
+
   /// @copydoc Mapping::mapConservative
   void mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) override;
 
   /// @copydoc Mapping::mapConsistent
   void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) override;
 
-  std::vector<Polation> _interpolations;
+  /// @copydoc Mapping::mapConservativeBatch
+  void mapConservativeBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData) override;
+
+  /// @copydoc Mapping::mapConsistentBatch
+  void mapConsistentBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData) override;
+
+  /**
+   * @brief Discards the current operator and computes a new one with a row per origin vertex
+   *
+   * All origins are passed to the query at once, which allows to use the batch queries of query::Index.
+   *
+   * @param[in] origins the mesh providing a row of the operator per vertex
+   * @param[in] query computes the projection of each column of a dims x n location matrix
+   *
+   * @returns the distance of the polation of each row
+   */
+  std::vector<double> computeOperator(const mesh::Mesh &origins, const BatchQuery &query);
+
+  /// Returns the number of rows of the operator
+  std::size_t operatorRows() const;
+
+  /**
+   * @brief Loads the operator from the given cache file
+   *
+   * @param[in] cache the cache entry to load
+   * @param[in] rows the expected number of rows
+   * @param[in] columns the expected number of columns, i.e., vertices of the search space
+   *
+   * @returns false and leaves the operator empty if the file is missing or doesn't match the expected shape
+   */
+  bool loadOperator(const CacheEntry &cache, std::size_t rows, std::size_t columns);
+
+  /// Stores the operator in the given cache entry, returns false on failure
+  bool storeOperator(const CacheEntry &cache) const;
+
+private:
+  /// Offsets of the rows in _columns and _weights, the last entry is the number of non-zeros
+  std::vector<std::size_t> _rowOffsets;
+
+  /// Vertex IDs of the non-zero entries
+  std::vector<int> _columns;
+
+  /// Weights of the non-zero entries
+  std::vector<double> _weights;
 };
 
 } // namespace mapping
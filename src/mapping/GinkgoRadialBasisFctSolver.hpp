@@ -75,6 +75,12 @@ public:
   /// Maps the given input data
   Eigen::VectorXd solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial);
 
+  /// Maps multiple right-hand sides, where each column of inputData is one right-hand side
+  Eigen::MatrixXd solveConsistent(const Eigen::MatrixXd &inputData, Polynomial polynomial);
+
+  /// Maps multiple right-hand sides, where each column of inputData is one right-hand side
+  Eigen::MatrixXd solveConservative(const Eigen::MatrixXd &inputData, Polynomial polynomial);
+
   void clear();
 
   Eigen::Index getInputSize() const;
@@ -613,6 +619,28 @@ Eigen::VectorXd GinkgoRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConser
   return result;
 }
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd GinkgoRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(const Eigen::MatrixXd &rhsValues, Polynomial polynomial)
+{
+  PRECICE_TRACE();
+  Eigen::MatrixXd result(getOutputSize(), rhsValues.cols());
+  for (Eigen::Index c = 0; c < rhsValues.cols(); ++c) {
+    result.col(c) = solveConsistent(Eigen::VectorXd(rhsValues.col(c)), polynomial);
+  }
+  return result;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd GinkgoRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative(const Eigen::MatrixXd &rhsValues, Polynomial polynomial)
+{
+  PRECICE_TRACE();
+  Eigen::MatrixXd result(getInputSize(), rhsValues.cols());
+  for (Eigen::Index c = 0; c < rhsValues.cols(); ++c) {
+    result.col(c) = solveConservative(Eigen::VectorXd(rhsValues.col(c)), polynomial);
+  }
+  return result;
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 std::shared_ptr<gko::Executor> GinkgoRadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getReferenceExecutor() const
 {
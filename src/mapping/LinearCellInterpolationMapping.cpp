@@ -68,23 +68,29 @@ void LinearCellInterpolationMapping::computeMapping()
     }
   }
 
+  // Reuse the operator of a previous run if the meshes didn't change
+  const CacheEntry cache = cacheEntry();
+  if (!cache.file.empty() && loadOperator(cache, fVertices.size(), searchSpace->nVertices())) {
+    PRECICE_INFO("Loaded mapping from cache file {}", cache.file);
+    _hasComputedMapping = true;
+    return;
+  }
+
   // Amount of nearest elements to fetch for detailed comparison.
   // This safety margin results in a candidate set which forms the base for the
   // local nearest projection and counters the loss of detail due to bounding box generation.
   // @TODO Add a configuration option for this factor
   constexpr int nnearest = 4;
 
-  auto &                                 index = searchSpace->index();
-  utils::statistics::DistanceAccumulator fallbackStatistics;
-
-  _interpolations.clear();
-  _interpolations.reserve(fVertices.size());
+  // Find tetrahedra (3D) or triangle (2D) or fall-back on NP
+  auto       &index     = searchSpace->index();
+  const auto  nThreads  = getNumberOfThreads();
+  const auto  distances = computeOperator(*origins, [&index, nThreads](const Eigen::Ref<const Eigen::MatrixXd> &locations) {
+    return index.findCellOrProjectionBatch(locations, nnearest, nThreads);
+  });
 
-  for (const auto &fVertex : fVertices) {
-    // Find tetrahedra (3D) or triangle (2D) or fall-back on NP
-    auto match    = index.findCellOrProjection(fVertex.getCoords(), nnearest);
-    auto distance = match.polation.distance();
-    _interpolations.push_back(std::move(match.polation));
+  utils::statistics::DistanceAccumulator fallbackStatistics;
+  for (double distance : distances) {
     if (!math::equals(distance, 0.0)) {
       // Only push when fall-back occurs, so the number of entries is the number of vertices outside the domain
       fallbackStatistics(distance);
@@ -116,6 +122,10 @@ void LinearCellInterpolationMapping::computeMapping()
     }
   }
 
+  if (!cache.file.empty() && !storeOperator(cache)) {
+    PRECICE_WARN("Storing the mapping in the cache file {} failed.", cache.file);
+  }
+
   _hasComputedMapping = true;
 }
 
@@ -1,6 +1,11 @@
 #include "Mapping.hpp"
+#include <algorithm>
 #include <boost/config.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <fmt/format.h>
 #include <ostream>
+#include <utility>
+#include "mapping/impl/OperatorCache.hpp"
 #include "math/differences.hpp"
 #include "mesh/Utils.hpp"
 #include "utils/IntraComm.hpp"
@@ -110,6 +115,64 @@ int Mapping::getDimensions() const
   return _dimensions;
 }
 
+void Mapping::setCacheDirectory(const std::string &directory)
+{
+  _cacheDirectory = directory;
+}
+
+void Mapping::setNumberOfThreads(unsigned int nThreads)
+{
+  _nThreads = nThreads;
+}
+
+unsigned int Mapping::getNumberOfThreads() const
+{
+  return _nThreads;
+}
+
+void Mapping::setOperatorRegistry(std::shared_ptr<OperatorRegistry> registry, std::string key)
+{
+  _operatorRegistry = std::move(registry);
+  _operatorKey      = std::move(key);
+}
+
+void Mapping::releaseSharedOperator(const void *op)
+{
+  if (_operatorRegistry && op) {
+    _operatorRegistry->erase(_operatorKey, op);
+  }
+}
+
+Mapping::CacheEntry Mapping::cacheEntry() const
+{
+  if (_cacheDirectory.empty() || _cacheSuspended) {
+    return {};
+  }
+  PRECICE_ASSERT(_input && _output, "Setting the meshes is required to derive the cache entry.");
+
+  const auto describeMesh = [](const mesh::Mesh &mesh) {
+    return fmt::format("{} (vertices {}, edges {}, triangles {}, tetrahedra {}, hash {:016x})",
+                       mesh.getName(), mesh.nVertices(), mesh.edges().size(), mesh.triangles().size(),
+                       mesh.tetrahedra().size(), impl::hashMesh(mesh));
+  };
+
+  CacheEntry entry;
+  entry.key = fmt::format("{}; constraint {}; dimensions {}; gradient {}; input {}; output {}; rank {} of {}",
+                          getName(), static_cast<int>(_constraint), _dimensions, _requiresGradientData,
+                          describeMesh(*_input), describeMesh(*_output),
+                          utils::IntraComm::getRank(), utils::IntraComm::getSize());
+
+  std::string name = getName();
+  std::replace(name.begin(), name.end(), ' ', '-');
+  entry.file = fmt::format("{}/{}-{:016x}.bin", _cacheDirectory, name, boost::hash_value(entry.key));
+  return entry;
+}
+
+void Mapping::suspendCache(bool suspend)
+{
+  _cacheSuspended = suspend;
+}
+
 bool Mapping::requiresGradientData() const
 {
   return _requiresGradientData;
@@ -171,6 +234,58 @@ void Mapping::map(const time::Sample &input, Eigen::VectorXd &output)
   }
 }
 
+void Mapping::mapBatch(const std::vector<const time::Sample *> &inputs, Eigen::MatrixXd &outputs)
+{
+  PRECICE_ASSERT(_hasComputedMapping);
+  PRECICE_ASSERT(!requiresInitialGuess(), "Mappings requiring an initial guess cannot map samples in batches.");
+
+  if (inputs.empty()) {
+    outputs.resize(0, 0);
+    return;
+  }
+
+  const int dataDims = inputs.front()->dataDims;
+  PRECICE_ASSERT(std::all_of(inputs.begin(), inputs.end(), [dataDims](const auto *sample) { return sample->dataDims == dataDims; }));
+
+  // Reuses the memory of outputs if the size matches
+  outputs.setZero(dataDims * output()->nVertices(), inputs.size());
+
+  if (hasConstraint(CONSERVATIVE)) {
+    mapConservativeBatch(inputs, outputs);
+  } else if (hasConstraint(CONSISTENT)) {
+    mapConsistentBatch(inputs, outputs);
+  } else if (isScaledConsistent()) {
+    mapConsistentBatch(inputs, outputs);
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+      Eigen::VectorXd scaled = outputs.col(i);
+      scaleConsistentMapping(inputs[i]->values, scaled, getConstraint());
+      outputs.col(i) = scaled;
+    }
+  } else {
+    PRECICE_UNREACHABLE("Unknown mapping constraint.")
+  }
+}
+
+void Mapping::mapConservativeBatch(const std::vector<const time::Sample *> &inputs, Eigen::MatrixXd &outputs)
+{
+  Eigen::VectorXd output(outputs.rows());
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    output.setZero();
+    mapConservative(*inputs[i], output);
+    outputs.col(i) = output;
+  }
+}
+
+void Mapping::mapConsistentBatch(const std::vector<const time::Sample *> &inputs, Eigen::MatrixXd &outputs)
+{
+  Eigen::VectorXd output(outputs.rows());
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    output.setZero();
+    mapConsistent(*inputs[i], output);
+    outputs.col(i) = output;
+  }
+}
+
 void Mapping::scaleConsistentMapping(const Eigen::VectorXd &input, Eigen::VectorXd &output, Mapping::Constraint constraint) const
 {
   PRECICE_ASSERT(isScaledConsistent());
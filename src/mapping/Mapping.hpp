@@ -2,7 +2,11 @@
 
 #include <Eigen/Core>
 #include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
 
+#include "mapping/OperatorRegistry.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 
@@ -168,6 +172,23 @@ public:
    */
   void map(const time::Sample &input, Eigen::VectorXd &output, Eigen::VectorXd &initialGuess);
 
+  /**
+   * @brief Maps multiple input \ref Sample "Samples" from input mesh to output mesh at once.
+   *
+   * All samples need to share the data dimensionality, as it is the case for all stamples of a data.
+   * Derived classes may override mapConsistentBatch() and mapConservativeBatch() to map all samples
+   * in a single traversal of the mapping operator.
+   *
+   * @param[in] inputs samples to map
+   * @param[out] outputs result data with one column per input sample, resized if required
+   *
+   * @pre \ref hasComputedMapping() == true
+   * @pre \ref requiresInitialGuess() == false
+   *
+   * @post outputs.col(i) contains the mapped data of inputs[i]
+   */
+  void mapBatch(const std::vector<const time::Sample *> &inputs, Eigen::MatrixXd &outputs);
+
   /// Method used by partition. Tags vertices that could be owned by this rank.
   virtual void tagMeshFirstRound() = 0;
 
@@ -189,6 +210,39 @@ public:
   /// Returns the name of the mapping method for logging purpose
   virtual std::string getName() const = 0;
 
+  /**
+   * @brief Sets a directory to store computed mapping operators in and to load them from.
+   *
+   * Mappings supporting the cache reuse a stored operator in computeMapping() if the meshes
+   * and the partitioning didn't change since the operator was stored.
+   * An empty directory disables the cache, which is the default.
+   *
+   * The cache is a partial realization: only the nearest-neighbor, nearest-projection and
+   * linear-cell-interpolation mappings support it. The radial-basis-function mappings, including
+   * the partition of unity, always assemble and decompose their systems in computeMapping(),
+   * although this is where a cache would save the most time.
+   */
+  void setCacheDirectory(const std::string &directory);
+
+  /**
+   * @brief Sets the maximal amount of threads used by computeMapping() of mappings supporting threads.
+   *
+   * A value of 0 uses all available hardware threads. The default is a single thread, which
+   * avoids oversubscribing nodes shared by several ranks.
+   */
+  void setNumberOfThreads(unsigned int nThreads);
+
+  /// Returns the maximal amount of threads to use, see setNumberOfThreads()
+  unsigned int getNumberOfThreads() const;
+
+  /**
+   * @brief Shares the computed operator with equivalent mappings using the same registry and key.
+   *
+   * Mappings supporting the registry reuse the operator of an equivalent mapping in computeMapping()
+   * instead of computing their own. Without a registry, which is the default, nothing is shared.
+   */
+  void setOperatorRegistry(std::shared_ptr<OperatorRegistry> registry, std::string key);
+
 protected:
   /// Returns pointer to input mesh.
   mesh::PtrMesh input() const;
@@ -204,6 +258,47 @@ protected:
 
   int getDimensions() const;
 
+  /// Location and identification of a cached operator
+  struct CacheEntry {
+    /// File storing the operator, empty if the cache is disabled
+    std::string file;
+
+    /// Description of the meshes and the mapping the operator was computed for
+    std::string key;
+  };
+
+  /**
+   * @brief Returns the cache entry of the operator of the current meshes and partitioning.
+   *
+   * The key lists the mapping name, the constraint, the dimensions, the names, sizes and hashes of both meshes
+   * and the partitioning. The file name is derived from a hash of the key, whereas the key itself is stored in
+   * the file and compared on load, such that hash collisions never result in a wrong operator.
+   * Returns an entry with an empty file if no cache directory is set or the cache is suspended.
+   */
+  CacheEntry cacheEntry() const;
+
+  /// Suspends the cache, which is used to skip temporary mappings on unfiltered meshes
+  void suspendCache(bool suspend);
+
+  /// Returns the operator computed by an equivalent mapping, or nullptr if there is none
+  template <typename Operator>
+  std::shared_ptr<Operator> findSharedOperator() const
+  {
+    return _operatorRegistry ? _operatorRegistry->find<Operator>(_operatorKey) : nullptr;
+  }
+
+  /// Offers the computed operator to equivalent mappings
+  template <typename Operator>
+  void shareOperator(const std::shared_ptr<Operator> &op)
+  {
+    if (_operatorRegistry) {
+      _operatorRegistry->insert(_operatorKey, op);
+    }
+  }
+
+  /// Withdraws the operator from equivalent mappings, which is required before the operator gets outdated
+  void releaseSharedOperator(const void *op);
+
   /// Flag to indicate whether computeMapping() has been called.
   bool _hasComputedMapping = false;
 
@@ -237,6 +332,26 @@ protected:
    */
   virtual void mapConsistent(const time::Sample &input, Eigen::VectorXd &output) = 0;
 
+  /**
+   * @brief Maps multiple samples using a conservative constraint
+   *
+   * The default implementation calls mapConservative() for every sample.
+   *
+   * @param[in] inputs Samples to map data from
+   * @param[in] outputs Zero-initialized values to map to, one column per sample
+   */
+  virtual void mapConservativeBatch(const std::vector<const time::Sample *> &inputs, Eigen::MatrixXd &outputs);
+
+  /**
+   * @brief Maps multiple samples using a consistent constraint
+   *
+   * The default implementation calls mapConsistent() for every sample.
+   *
+   * @param[in] inputs Samples to map data from
+   * @param[in] outputs Zero-initialized values to map to, one column per sample
+   */
+  virtual void mapConsistentBatch(const std::vector<const time::Sample *> &inputs, Eigen::MatrixXd &outputs);
+
 private:
   /// Determines whether mapping is consistent or conservative.
   Constraint _constraint;
@@ -255,6 +370,21 @@ private:
 
   int _dimensions;
 
+  /// Directory of the operator cache, empty if disabled
+  std::string _cacheDirectory;
+
+  /// Whether the cache is suspended, see suspendCache()
+  bool _cacheSuspended = false;
+
+  /// Maximal amount of threads, where 0 uses all available hardware threads
+  unsigned int _nThreads = 1;
+
+  /// Registry of operators shared with equivalent mappings, nullptr if disabled
+  std::shared_ptr<OperatorRegistry> _operatorRegistry;
+
+  /// Key of the operator in the registry
+  std::string _operatorKey;
+
   /// The InitialGuessRequirement of the Mapping
   InitialGuessRequirement _initialGuessRequirement;
 
@@ -1,16 +1,19 @@
 #include "NearestNeighborBaseMapping.hpp"
 
+#include <algorithm>
 #include <boost/container/flat_set.hpp>
 #include <functional>
 #include <iostream>
 #include "logging/LogMacros.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/impl/OperatorCache.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "mesh/Vertex.hpp"
 #include "profiling/Event.hpp"
 #include "utils/IntraComm.hpp"
 #include "utils/Parallel.hpp"
 #include "utils/Statistics.hpp"
+#include "utils/Threading.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice::mapping {
@@ -50,22 +53,33 @@ void NearestNeighborBaseMapping::computeMapping()
   }
 
   // Set up of output arrays
-  const size_t verticesSize   = origins->nVertices();
-  const auto & sourceVertices = origins->vertices();
-  _vertexIndices.resize(verticesSize);
+  const size_t verticesSize = origins->nVertices();
+
+  // Reuse the operator of a previous run if the meshes didn't change
+  const CacheEntry cache = cacheEntry();
+  if (!cache.file.empty() && loadCachedMapping(cache, verticesSize, searchSpace->nVertices())) {
+    PRECICE_INFO("Loaded mapping from cache file {}", cache.file);
+    onMappingComputed(origins, searchSpace);
+    _hasComputedMapping = true;
+    return;
+  }
 
-  // Needed for error calculations
-  utils::statistics::DistanceAccumulator distanceStatistics;
+  // Query the index for all vertices at once
+  const auto sourceCoords = origins->vertexCoordinates();
+  _vertexIndices          = searchSpace->index().getClosestVertexBatch(sourceCoords, getNumberOfThreads());
 
-  auto &index = searchSpace->index();
-  for (size_t i = 0; i < verticesSize; ++i) {
-    const auto &sourceCoords  = sourceVertices[i].getCoords();
-    const auto &matchedVertex = index.getClosestVertex(sourceCoords);
-    _vertexIndices[i]         = matchedVertex.index;
+  // Compute distance between input and output vertices for the stats
+  const auto          matchedCoords = searchSpace->vertexCoordinates();
+  std::vector<double> distances(verticesSize);
+  utils::parallelForChunks(verticesSize, utils::chunkCount(verticesSize, 4096, getNumberOfThreads()), [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      distances[i] = (sourceCoords.col(i) - matchedCoords.col(_vertexIndices[i])).norm();
+    }
+  });
 
-    // Compute distance between input and output vertiex for the stats
-    const auto &matchCoords = searchSpace->vertex(matchedVertex.index).getCoords();
-    auto        distance    = (sourceCoords - matchCoords).norm();
+  // Needed for error calculations, accumulated in order to obtain reproducible statistics
+  utils::statistics::DistanceAccumulator distanceStatistics;
+  for (double distance : distances) {
     distanceStatistics(distance);
   }
 
@@ -80,9 +94,23 @@ void NearestNeighborBaseMapping::computeMapping()
     PRECICE_INFO("Mapping distance {}", distanceStatistics);
   }
 
+  if (!cache.file.empty() && !impl::OperatorCache::write(cache.file, cache.key, _vertexIndices)) {
+    PRECICE_WARN("Storing the mapping in the cache file {} failed.", cache.file);
+  }
+
   _hasComputedMapping = true;
 }
 
+bool NearestNeighborBaseMapping::loadCachedMapping(const CacheEntry &cache, std::size_t nOrigins, std::size_t nSearchSpace)
+{
+  if (!impl::OperatorCache::read(cache.file, cache.key, _vertexIndices) || _vertexIndices.size() != nOrigins ||
+      std::any_of(_vertexIndices.begin(), _vertexIndices.end(), [nSearchSpace](int index) { return index < 0 || static_cast<std::size_t>(index) >= nSearchSpace; })) {
+    _vertexIndices.clear();
+    return false;
+  }
+  return true;
+}
+
 void NearestNeighborBaseMapping::clear()
 {
   PRECICE_TRACE();
@@ -90,7 +118,7 @@ void NearestNeighborBaseMapping::clear()
   _hasComputedMapping = false;
 
   if (requiresGradientData())
-    _offsetsMatched.clear();
+    _offsetsMatched.resize(0, 0);
 
   if (getConstraint() == CONSISTENT) {
     input()->index().clear();
@@ -109,7 +137,10 @@ void NearestNeighborBaseMapping::tagMeshFirstRound()
   PRECICE_TRACE();
   precice::profiling::Event e("map." + mappingNameShort + ".tagMeshFirstRound.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
 
+  // The mapping on the unfiltered meshes is temporary and must not be cached
+  suspendCache(true);
   computeMapping();
+  suspendCache(false);
 
   // Lookup table of all indices used in the mapping
   const boost::container::flat_set<int> indexSet(_vertexIndices.begin(), _vertexIndices.end());
@@ -45,12 +45,15 @@ protected:
 
   mutable logging::Logger _log{"mapping::" + mappingName};
 
-  /// Compute the vector offset between the matched vector and the source vector (needed for gradient mapping)
-  /// Optimization: save this as an std::vector<double> and use an Eigen::Map to create an interface that uses the correct dimensions.
-  std::vector<Eigen::VectorXd> _offsetsMatched;
+  /// Offsets between the source vertices and their matched vertices (needed for gradient mapping), one column per source vertex
+  Eigen::MatrixXd _offsetsMatched;
 
   /// Computed output vertex indices to map data from input vertices to.
   std::vector<int> _vertexIndices;
+
+private:
+  /// Loads the vertex indices from the cache entry, returns false if the file is missing or doesn't match the meshes
+  bool loadCachedMapping(const CacheEntry &cache, std::size_t nOrigins, std::size_t nSearchSpace);
 };
 
 } // namespace mapping
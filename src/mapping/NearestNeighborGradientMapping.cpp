@@ -6,8 +6,10 @@
 #include <functional>
 #include <iostream>
 #include <strings.h>
+#include <vector>
 #include "logging/LogMacros.hpp"
 #include "profiling/Event.hpp"
+#include "time/Sample.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/IntraComm.hpp"
 #include "utils/assertion.hpp"
@@ -33,22 +35,71 @@ NearestNeighborGradientMapping::NearestNeighborGradientMapping(
   }
 }
 
-void NearestNeighborGradientMapping::onMappingComputed(mesh::PtrMesh origins, mesh::PtrMesh searchSpace)
+namespace {
+
+/**
+ * @brief Computes value + gradient^T * offset of all components of the matched vertices for all samples
+ *
+ * The gradients of all components of a vertex are a contiguous Dims x ValueDims block, which allows to
+ * evaluate all components at once.
+ */
+template <int Dims, int ValueDims>
+void mapWithGradients(const std::vector<int> &vertexIndices, const Eigen::MatrixXd &offsets, int valueDims,
+                      const std::vector<const time::Sample *> &in, const std::vector<double *> &out)
+{
+  using Offset    = Eigen::Matrix<double, Dims, 1>;
+  using Values    = Eigen::Matrix<double, ValueDims, 1>;
+  using Gradients = Eigen::Matrix<double, Dims, ValueDims>;
+
+  const int dims = offsets.rows();
+  for (std::size_t i = 0; i < vertexIndices.size(); ++i) {
+    const Eigen::Map<const Offset> offset(offsets.col(i).data(), dims);
+    const std::size_t              inputIndex = static_cast<std::size_t>(vertexIndices[i]) * valueDims;
+
+    for (std::size_t s = 0; s < in.size(); ++s) {
+      const Eigen::Map<const Values>    values(in[s]->values.data() + inputIndex, valueDims);
+      const Eigen::Map<const Gradients> gradients(in[s]->gradients.data() + inputIndex * dims, dims, valueDims);
+      Eigen::Map<Values>(out[s] + i * valueDims, valueDims).noalias() = values + gradients.transpose() * offset;
+    }
+  }
+}
+
+/// Dispatches to the kernel specialized for the mesh dimensions and the component count
+template <int Dims>
+void mapWithGradients(const std::vector<int> &vertexIndices, const Eigen::MatrixXd &offsets, int valueDims,
+                      const std::vector<const time::Sample *> &in, const std::vector<double *> &out)
 {
+  switch (valueDims) {
+  case 1:
+    return mapWithGradients<Dims, 1>(vertexIndices, offsets, valueDims, in, out);
+  case 2:
+    return mapWithGradients<Dims, 2>(vertexIndices, offsets, valueDims, in, out);
+  case 3:
+    return mapWithGradients<Dims, 3>(vertexIndices, offsets, valueDims, in, out);
+  default:
+    return mapWithGradients<Dims, Eigen::Dynamic>(vertexIndices, offsets, valueDims, in, out);
+  }
+}
 
-  // Initialize the offsets list
-  _offsetsMatched.resize(_vertexIndices.size());
+} // namespace
+
+void NearestNeighborGradientMapping::onMappingComputed(mesh::PtrMesh origins, mesh::PtrMesh searchSpace)
+{
+  // Initialize the offsets
+  _offsetsMatched.resize(getDimensions(), _vertexIndices.size());
 
   // Calculate offsets
+  const auto sourceCoords  = origins->vertexCoordinates();
+  const auto matchedCoords = searchSpace->vertexCoordinates();
   for (size_t i = 0; i < _vertexIndices.size(); ++i) {
 
-    const auto &matchedVertexCoords = searchSpace->vertex(_vertexIndices[i]).getCoords();
-    const auto &sourceVertexCoords  = origins->vertex(i).getCoords();
+    const auto matchedVertexCoords = matchedCoords.col(_vertexIndices[i]);
+    const auto sourceVertexCoords  = sourceCoords.col(i);
 
     // We calculate the distances uniformly for consistent mapping constraint as the difference (output - input)
     // For consistent mapping: the source is the output vertex and the matched vertex is the input since we iterate over all outputs
     // and assign each exactly one vertex form the search space, which are our origins vertices.
-    _offsetsMatched[i] = sourceVertexCoords - matchedVertexCoords;
+    _offsetsMatched.col(i) = sourceVertexCoords - matchedVertexCoords;
   }
 };
 
@@ -57,35 +108,49 @@ void NearestNeighborGradientMapping::mapConsistent(const time::Sample &inData, E
   PRECICE_TRACE();
   precice::profiling::Event e("map." + mappingNameShort + ".mapData.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
 
-  PRECICE_ASSERT(inData.values.size() == 0 || inData.gradients.size() != 0,
-                 "Mesh \"{}\" does not contain gradient data. Using Nearest Neighbor Gradient mapping requires gradient data.",
-                 input()->getName());
-
-  /// Check if input has gradient data, else send Error
-  PRECICE_WARN_IF(input()->empty(), "The mesh doesn't contain any vertices.");
-
-  const int              valueDimensions = inData.dataDims;
-  const Eigen::VectorXd &inputValues     = inData.values;
-  Eigen::VectorXd &      outputValues    = outData;
-  const Eigen::MatrixXd &gradients       = inData.gradients;
-
   // Consistent mapping
   PRECICE_DEBUG("Map {} using {}", (hasConstraint(CONSISTENT) ? "consistent" : "scaled-consistent"), getName());
-  const size_t outSize = output()->nVertices();
+  mapConsistentSamples({&inData}, {outData.data()});
 
-  for (size_t i = 0; i < outSize; i++) {
-    int inputIndex = _vertexIndices[i] * valueDimensions;
+  PRECICE_DEBUG("Mapped values (with gradient) = {}", utils::previewRange(3, outData));
+}
 
-    for (int dim = 0; dim < valueDimensions; dim++) {
+void NearestNeighborGradientMapping::mapConsistentBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData)
+{
+  PRECICE_TRACE();
+  precice::profiling::Event e("map." + mappingNameShort + ".mapData.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
+  PRECICE_DEBUG("Map {} using {} for {} samples", (hasConstraint(CONSISTENT) ? "consistent" : "scaled-consistent"), getName(), inData.size());
 
-      const int mapOutputIndex = (i * valueDimensions) + dim;
-      const int mapInputIndex  = inputIndex + dim;
+  std::vector<double *> out;
+  for (Eigen::Index s = 0; s < outData.cols(); ++s) {
+    out.push_back(outData.col(s).data());
+  }
+  mapConsistentSamples(inData, out);
+}
 
-      outputValues(mapOutputIndex) = inputValues(mapInputIndex) + _offsetsMatched[i].transpose() * gradients.col(mapInputIndex);
-    }
+void NearestNeighborGradientMapping::mapConsistentSamples(const std::vector<const time::Sample *> &inData, const std::vector<double *> &outData)
+{
+  PRECICE_ASSERT(inData.size() == outData.size());
+
+  /// Check if input has gradient data, else send Error
+  PRECICE_WARN_IF(input()->empty(), "The mesh doesn't contain any vertices.");
+
+  const int valueDimensions = inData.front()->dataDims;
+  for (const auto *sample : inData) {
+    PRECICE_ASSERT(sample->values.size() == 0 || sample->gradients.size() != 0,
+                   "Mesh \"{}\" does not contain gradient data. Using Nearest Neighbor Gradient mapping requires gradient data.",
+                   input()->getName());
+    PRECICE_ASSERT(sample->dataDims == valueDimensions);
+    PRECICE_ASSERT(sample->gradients.rows() == 0 || sample->gradients.rows() == getDimensions(), sample->gradients.rows(), getDimensions());
   }
+  PRECICE_ASSERT(_vertexIndices.size() == output()->nVertices(), _vertexIndices.size(), output()->nVertices());
+  PRECICE_ASSERT(static_cast<std::size_t>(_offsetsMatched.cols()) == _vertexIndices.size());
 
-  PRECICE_DEBUG("Mapped values (with gradient) = {}", utils::previewRange(3, outputValues));
+  if (getDimensions() == 2) {
+    mapWithGradients<2>(_vertexIndices, _offsetsMatched, valueDimensions, inData, outData);
+  } else {
+    mapWithGradients<3>(_vertexIndices, _offsetsMatched, valueDimensions, inData, outData);
+  }
 }
 
 void NearestNeighborGradientMapping::mapConservative(const time::Sample & /* inData */, Eigen::VectorXd & /* outData */)
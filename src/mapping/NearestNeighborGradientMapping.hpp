@@ -31,6 +31,13 @@ protected:
 
   /// @copydoc Mapping::mapConsistent
   void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) final override;
+
+  /// @copydoc Mapping::mapConsistentBatch
+  void mapConsistentBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData) final override;
+
+private:
+  /// Checks the input of the samples and maps them in a single traversal of the matched vertices
+  void mapConsistentSamples(const std::vector<const time::Sample *> &inData, const std::vector<double *> &outData);
 };
 
 } // namespace mapping
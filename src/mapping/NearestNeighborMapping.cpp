@@ -80,6 +80,48 @@ void NearestNeighborMapping::mapConsistent(const time::Sample &inData, Eigen::Ve
   PRECICE_DEBUG("Mapped values = {}", utils::previewRange(3, outputValues));
 }
 
+void NearestNeighborMapping::mapConservativeBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData)
+{
+  PRECICE_TRACE();
+  precice::profiling::Event e("map." + mappingNameShort + ".mapData.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
+  PRECICE_DEBUG("Map conservative using {} for {} samples", getName(), inData.size());
+
+  // Data dimensions (for scalar = 1, for vectors > 1)
+  const size_t inSize          = input()->nVertices();
+  const int    valueDimensions = inData.front()->dataDims;
+
+  // Traverse the vertex indices once for all samples
+  for (size_t i = 0; i < inSize; i++) {
+    int const outputIndex = _vertexIndices[i] * valueDimensions;
+    int const inputIndex  = i * valueDimensions;
+
+    for (size_t s = 0; s < inData.size(); ++s) {
+      outData.col(s).segment(outputIndex, valueDimensions) += inData[s]->values.segment(inputIndex, valueDimensions);
+    }
+  }
+}
+
+void NearestNeighborMapping::mapConsistentBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData)
+{
+  PRECICE_TRACE();
+  precice::profiling::Event e("map." + mappingNameShort + ".mapData.From" + input()->getName() + "To" + output()->getName(), profiling::Synchronize);
+  PRECICE_DEBUG("Map {} using {} for {} samples", (hasConstraint(CONSISTENT) ? "consistent" : "scaled-consistent"), getName(), inData.size());
+
+  // Data dimensions (for scalar = 1, for vectors > 1)
+  const size_t outSize         = output()->nVertices();
+  const int    valueDimensions = inData.front()->dataDims;
+
+  // Traverse the vertex indices once for all samples
+  for (size_t i = 0; i < outSize; i++) {
+    int const inputIndex  = _vertexIndices[i] * valueDimensions;
+    int const outputIndex = i * valueDimensions;
+
+    for (size_t s = 0; s < inData.size(); ++s) {
+      outData.col(s).segment(outputIndex, valueDimensions) = inData[s]->values.segment(inputIndex, valueDimensions);
+    }
+  }
+}
+
 std::string NearestNeighborMapping::getName() const
 {
   return "nearest-neighbor";
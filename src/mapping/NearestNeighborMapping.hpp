@@ -28,6 +28,12 @@ protected:
 
   /// @copydoc Mapping::mapConsistent
   void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) final override;
+
+  /// @copydoc Mapping::mapConservativeBatch
+  void mapConservativeBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData) final override;
+
+  /// @copydoc Mapping::mapConsistentBatch
+  void mapConsistentBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData) final override;
 };
 
 } // namespace mapping
@@ -74,24 +74,31 @@ void NearestProjectionMapping::computeMapping()
                     searchSpace->getName());
   }
 
+  // Reuse the operator of a previous run if the meshes didn't change
+  const CacheEntry cache = cacheEntry();
+  if (!cache.file.empty() && loadOperator(cache, fVertices.size(), searchSpace->nVertices())) {
+    PRECICE_INFO("Loaded mapping from cache file {}", cache.file);
+    _hasComputedMapping = true;
+    return;
+  }
+
   // Amount of nearest elements to fetch for detailed comparison.
   // This safety margin results in a candidate set which forms the base for the
   // local nearest projection and counters the loss of detail due to bounding box generation.
   // @TODO Add a configuration option for this factor
   constexpr int nnearest = 4;
 
-  utils::statistics::DistanceAccumulator distanceStatistics;
-
-  _interpolations.clear();
-  _interpolations.reserve(fVertices.size());
+  // Nearest projection element is edge for 2d if exists, if not, it is the nearest vertex
+  // Nearest projection element is triangle for 3d if exists, if not the edge and at the worst case it is the nearest vertex
+  auto       &index     = searchSpace->index();
+  const auto  nThreads  = getNumberOfThreads();
+  const auto  distances = computeOperator(*origins, [&index, nThreads](const Eigen::Ref<const Eigen::MatrixXd> &locations) {
+    return index.findNearestProjectionBatch(locations, nnearest, nThreads);
+  });
 
-  auto &index = searchSpace->index();
-  for (const auto &fVertex : fVertices) {
-    // Nearest projection element is edge for 2d if exists, if not, it is the nearest vertex
-    // Nearest projection element is triangle for 3d if exists, if not the edge and at the worst case it is the nearest vertex
-    auto match = index.findNearestProjection(fVertex.getCoords(), nnearest);
-    distanceStatistics(match.polation.distance());
-    _interpolations.push_back(std::move(match.polation));
+  utils::statistics::DistanceAccumulator distanceStatistics;
+  for (double distance : distances) {
+    distanceStatistics(distance);
   }
 
   if (distanceStatistics.empty()) {
@@ -100,6 +107,10 @@ void NearestProjectionMapping::computeMapping()
     PRECICE_INFO("Mapping distance {}", distanceStatistics);
   }
 
+  if (!cache.file.empty() && !storeOperator(cache)) {
+    PRECICE_WARN("Storing the mapping in the cache file {} failed.", cache.file);
+  }
+
   _hasComputedMapping = true;
 }
 
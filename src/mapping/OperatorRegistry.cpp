@@ -0,0 +1,13 @@
+#include "mapping/OperatorRegistry.hpp"
+
+namespace precice::mapping {
+
+void OperatorRegistry::erase(const std::string &key, const void *op)
+{
+  // A mapping may hold an outdated operator, which must not remove the operator of an equivalent mapping
+  if (auto iter = _operators.find(key); iter != _operators.end() && (iter->second.expired() || iter->second.lock().get() == op)) {
+    _operators.erase(iter);
+  }
+}
+
+} // namespace precice::mapping
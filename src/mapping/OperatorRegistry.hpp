@@ -0,0 +1,48 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace precice {
+namespace mapping {
+
+/**
+ * @brief Shares computed mapping operators between equivalent mappings
+ *
+ * A consistent mapping from mesh A to mesh B and a conservative mapping from mesh B to mesh A
+ * with identical settings solve the same interpolation system on mesh A, where the conservative
+ * mapping applies its transpose. Such mappings register their operator under the same key.
+ *
+ * The registry only holds weak references, hence, an operator is released as soon as the last
+ * mapping using it is cleared.
+ */
+class OperatorRegistry {
+public:
+  /// Returns the operator registered under the given key, or nullptr if there is none
+  template <typename Operator>
+  std::shared_ptr<Operator> find(const std::string &key) const
+  {
+    if (auto iter = _operators.find(key); iter != _operators.end()) {
+      return std::static_pointer_cast<Operator>(iter->second.lock());
+    }
+    return nullptr;
+  }
+
+  /// Registers the operator under the given key, which replaces a previously registered operator
+  template <typename Operator>
+  void insert(const std::string &key, const std::shared_ptr<Operator> &op)
+  {
+    _operators[key] = std::static_pointer_cast<void>(std::const_pointer_cast<std::remove_const_t<Operator>>(op));
+  }
+
+  /// Removes the operator registered under the given key, if it is the given operator
+  void erase(const std::string &key, const void *op);
+
+private:
+  std::map<std::string, std::weak_ptr<void>> _operators;
+};
+
+} // namespace mapping
+} // namespace precice
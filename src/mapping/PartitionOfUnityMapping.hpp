@@ -1,7 +1,11 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <limits>
 #include <numeric>
+#include <optional>
+#include <string>
+#include <tuple>
 
 #include "com/Communication.hpp"
 #include "io/ExportVTU.hpp"
@@ -12,6 +16,7 @@
 #include "profiling/Event.hpp"
 #include "query/Index.hpp"
 #include "utils/IntraComm.hpp"
+#include "utils/Threading.hpp"
 
 namespace precice {
 extern bool syncMode;
@@ -42,6 +47,9 @@ public:
    * clusters centers.
    * @param[in] projectToInput if enabled, places the cluster centers at the closest vertex of the input mesh.
    * See also \ref mapping::impl::createClustering()
+   * @param[in] nThreads number of threads used to compute the clusters and to evaluate the mapping, 0 uses all available threads
+   * @param[in] greedyTolerance if positive, each cluster selects its RBF centers greedily, see \ref RadialBasisFctSolver
+   * @param[in] balanceClusters if enabled, balances the cost of the clusters, see \ref mapping::impl::balanceClustering()
    */
   PartitionOfUnityMapping(
       Mapping::Constraint     constraint,
@@ -50,7 +58,10 @@ public:
       Polynomial              polynomial,
       unsigned int            verticesPerCluster,
       double                  relativeOverlap,
-      bool                    projectToInput);
+      bool                    projectToInput,
+      unsigned int            nThreads        = 1,
+      double                  greedyTolerance = 0.,
+      bool                    balanceClusters = false);
 
   /**
    * Computes the clustering for the partition of unity method and fills the \p _clusters vector,
@@ -59,11 +70,11 @@ public:
    * In addition, the method computes the normalized weights (Shepard's method) for the partition
    * of unity method and stores them directly in each relevant vertex cluster.
    * In debug mode, the function also exports the partition centers as a separate mesh for visualization
-   * purpose.
+   * purpose. If an equivalent mapping in the opposite direction computed its clusters already, they are reused.
    */
   void computeMapping() final override;
 
-  /// Clears a computed mapping by deleting the content of the \p _clusters vector.
+  /// Clears a computed mapping by releasing the \p _clusters vector.
   void clear() final override;
 
   /// tag the vertices required for the mapping
@@ -79,8 +90,36 @@ private:
   /// logger, as usual
   precice::logging::Logger _log{"mapping::PartitionOfUnityMapping"};
 
-  /// main data container storing all the clusters, which need to be solved individually
-  std::vector<SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>> _clusters;
+  using Clusters = std::vector<SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>>;
+
+  /// Meshes and settings the clusters were computed for, which an equivalent mapping has to match to reuse the clusters
+  struct ClusterSetup {
+    std::string  inMesh;
+    std::string  outMesh;
+    std::size_t  nInVertices;
+    std::size_t  nOutVertices;
+    unsigned int verticesPerCluster;
+    double       relativeOverlap;
+    bool         projectToInput;
+    bool         balanceClusters;
+    double       greedyTolerance;
+    Polynomial   polynomial;
+
+    bool operator==(const ClusterSetup &other) const
+    {
+      return std::tie(inMesh, outMesh, nInVertices, nOutVertices, verticesPerCluster, relativeOverlap, projectToInput, balanceClusters, greedyTolerance, polynomial) ==
+             std::tie(other.inMesh, other.outMesh, other.nInVertices, other.nOutVertices, other.verticesPerCluster, other.relativeOverlap, other.projectToInput, other.balanceClusters, other.greedyTolerance, other.polynomial);
+    }
+  };
+
+  /// The clusters along with their setup
+  struct SharedClusters {
+    ClusterSetup setup;
+    Clusters     clusters;
+  };
+
+  /// main data container storing all the clusters, which need to be solved individually, may be shared with an equivalent mapping
+  std::shared_ptr<const SharedClusters> _clusters;
 
   /// Radial basis function type used in interpolation
   RADIAL_BASIS_FUNCTION_T _basisFunction;
@@ -96,6 +135,19 @@ private:
   /// toggles whether we project the cluster centers to the input mesh
   const bool _projectToInput;
 
+  /// number of threads used to compute and evaluate the clusters
+  const unsigned int _nThreads;
+
+  /// tolerance of the greedy center selection in each cluster, 0 disables the selection
+  const double _greedyTolerance;
+
+  /// toggles whether the cost of the clusters is balanced by adapting their radii
+  const bool _balanceClusters;
+
+  /// minimal amount of clusters and vertices per thread, which amortizes the cost of spawning the thread
+  static constexpr std::size_t minClustersPerThread = 16;
+  static constexpr std::size_t minVerticesPerThread = 1024;
+
   /// derived parameter based on the input above: the radius of each cluster
   double _clusterRadius = 0;
 
@@ -108,6 +160,10 @@ private:
   /// @copydoc Mapping::mapConsistent
   virtual void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) override;
 
+  /// Evaluates all clusters using the given function and accumulates their contributions in \p outData
+  template <typename Func>
+  void evaluateClusters(Eigen::VectorXd &outData, Func &&evaluate) const;
+
   /// export the center vertices of all clusters as a mesh with some additional data on it such as vertex count
   /// only enabled in debug builds and mainly for debugging purpose
   void exportClusterCentersAsVTU(mesh::Mesh &centers);
@@ -121,11 +177,19 @@ PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::PartitionOfUnityMapping(
     Polynomial              polynomial,
     unsigned int            verticesPerCluster,
     double                  relativeOverlap,
-    bool                    projectToInput)
+    bool                    projectToInput,
+    unsigned int            nThreads,
+    double                  greedyTolerance,
+    bool                    balanceClusters)
     : Mapping(constraint, dimension, false, Mapping::InitialGuessRequirement::None),
-      _basisFunction(function), _verticesPerCluster(verticesPerCluster), _relativeOverlap(relativeOverlap), _projectToInput(projectToInput), _polynomial(polynomial)
+      _basisFunction(function), _verticesPerCluster(verticesPerCluster), _relativeOverlap(relativeOverlap), _projectToInput(projectToInput),
+      _nThreads(nThreads == 0 ? utils::availableThreads() : nThreads), _greedyTolerance(greedyTolerance), _balanceClusters(balanceClusters), _polynomial(polynomial)
 {
   PRECICE_ASSERT(this->getDimensions() <= 3);
+  // Checked here already, as the clusters are constructed concurrently
+  PRECICE_CHECK(_greedyTolerance == 0 || RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(),
+                "The greedy center selection of the rbf-pum-direct mapping requires a strictly positive definite basis function, "
+                "such as gaussian, inverse-multiquadrics or any compactly supported function. Please select another basis function or remove the attribute \"greedy-tolerance\".");
   PRECICE_ASSERT(_polynomial != Polynomial::ON, "Integrated polynomial is not supported for partition of unity data mappings.");
   PRECICE_ASSERT(_relativeOverlap < 1, "The relative overlap has to be smaller than one.");
   PRECICE_ASSERT(_verticesPerCluster > 0, "The number of vertices per cluster has to be greater zero.");
@@ -159,45 +223,95 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
     outMesh = this->output();
   }
 
+  // An equivalent mapping in the opposite direction uses the same clusters, unless it computed them for other meshes, e.g., filtered differently
+  const ClusterSetup setup{inMesh->getName(), outMesh->getName(), inMesh->nVertices(), outMesh->nVertices(), _verticesPerCluster,
+                           _relativeOverlap, _projectToInput, _balanceClusters, _greedyTolerance, _polynomial};
+  if (auto equivalentClusters = this->template findSharedOperator<const SharedClusters>()) {
+    if (equivalentClusters->setup == setup) {
+      PRECICE_DEBUG("Reusing the clusters of an equivalent mapping.");
+      const auto &clusters      = equivalentClusters->clusters;
+      _clusterRadius            = std::accumulate(clusters.begin(), clusters.end(), 0., [](double radius, const auto &cluster) { return std::max(radius, cluster.getRadius()); });
+      _clusters                 = std::move(equivalentClusters);
+      this->_hasComputedMapping = true;
+      return;
+    }
+    PRECICE_DEBUG("The clusters of an equivalent mapping were computed for other meshes and are recomputed.");
+  }
+
   precice::profiling::Event eClusters("map.pou.computeMapping.createClustering.From" + this->input()->getName() + "To" + this->output()->getName());
   // Step 1: get a tentative clustering consisting of centers and a radius from one of the available algorithms
   auto [clusterRadius, centerCandidates] = impl::createClustering(inMesh, outMesh, _relativeOverlap, _verticesPerCluster, _projectToInput);
+  // Step 1b: optionally balance the cost of the clusters, which adapts the radius of each cluster
+  const std::vector<double> clusterRadii = _balanceClusters ? impl::balanceClustering(centerCandidates, clusterRadius, inMesh, outMesh, _relativeOverlap, _verticesPerCluster, _projectToInput)
+                                                            : std::vector<double>(centerCandidates.size(), clusterRadius);
   eClusters.stop();
 
-  _clusterRadius = clusterRadius;
+  // The largest radius bounds the queries for the clusters of a vertex
+  _clusterRadius = clusterRadii.empty() ? clusterRadius : *std::max_element(clusterRadii.begin(), clusterRadii.end());
   PRECICE_ASSERT(_clusterRadius > 0 || inMesh->nVertices() == 0 || outMesh->nVertices() == 0);
 
   // Step 2: check, which of the resulting clusters are non-empty and register the cluster centers in a mesh
   // Here, the VertexCluster computes the matrix decompositions directly in case the cluster is non-empty
   mesh::Mesh centerMesh("pou-centers-" + inMesh->getName(), this->getDimensions(), mesh::Mesh::MESH_ID_UNDEFINED);
-  auto &     meshVertices = centerMesh.vertices();
 
-  meshVertices.clear();
-  _clusters.clear();
-  _clusters.reserve(centerCandidates.size());
-  for (const auto &c : centerCandidates) {
-    // We cannot simply copy the vertex from the container in order to fill the vertices of the centerMesh, as the vertexID of each center needs to match the index
-    // of the cluster within the _clusters vector. That's required for the indexing further down and asserted below
-    const VertexID                                  vertexID = meshVertices.size();
-    mesh::Vertex                                    center(c.getCoords(), vertexID);
-    SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T> cluster(center, _clusterRadius, _basisFunction, _polynomial, inMesh, outMesh);
+  auto sharedClusters   = std::make_shared<SharedClusters>();
+  sharedClusters->setup = setup;
+  auto &clusters        = sharedClusters->clusters;
+  clusters.reserve(centerCandidates.size());
+
+  // The clusters are independent of each other, such that we construct them concurrently. The fixed-radius
+  // vertex queries of the clusters are safe to run concurrently. Building their vertex grids beforehand avoids waiting for each other.
+  precice::profiling::Event eSolvers("map.pou.computeMapping.computeClusters");
+  SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::buildVertexGrids(_basisFunction, clusterRadii, inMesh, outMesh);
+
+  std::vector<std::optional<SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>>> candidateClusters(centerCandidates.size());
+  utils::parallelForChunks(centerCandidates.size(), utils::chunkCount(centerCandidates.size(), minClustersPerThread, _nThreads), [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      mesh::Vertex center(centerCandidates[i].getCoords(), i);
+      candidateClusters[i].emplace(center, clusterRadii[i], _basisFunction, _polynomial, _greedyTolerance, inMesh, outMesh);
+    }
+  });
+  eSolvers.stop();
 
+  for (std::size_t i = 0; i < candidateClusters.size(); ++i) {
     // Consider only non-empty clusters (more of a safeguard here)
-    if (!cluster.empty()) {
-      PRECICE_ASSERT(center.getID() == static_cast<int>(_clusters.size()), center.getID(), _clusters.size());
-      meshVertices.emplace_back(std::move(center));
-      _clusters.emplace_back(std::move(cluster));
+    if (candidateClusters[i]->empty()) {
+      continue;
+    }
+    // We cannot simply copy the vertex from the container in order to fill the vertices of the centerMesh, as the vertexID of each center needs to match the index
+    // of the cluster within the clusters vector. That's required for the indexing further down and asserted below
+    const VertexID vertexID = centerMesh.createVertex(centerCandidates[i].getCoords()).getID();
+    PRECICE_ASSERT(vertexID == static_cast<int>(clusters.size()), vertexID, clusters.size());
+    clusters.emplace_back(std::move(*candidateClusters[i]));
+  }
+  candidateClusters.clear();
+
+  e.addData("n clusters", clusters.size());
+  // Record the distribution of the cluster sizes and the estimated cost of the clusters
+  if (clusters.size() > 0) {
+    std::size_t minSize = std::numeric_limits<std::size_t>::max(), maxSize = 0, totalSize = 0;
+    double      maxCost = 0, totalCost = 0;
+    for (const auto &cluster : clusters) {
+      const std::size_t size = cluster.getNumberOfInputVertices();
+      minSize                = std::min(minSize, size);
+      maxSize                = std::max(maxSize, size);
+      totalSize += size;
+      maxCost = std::max(maxCost, impl::estimateClusterCost(size));
+      totalCost += impl::estimateClusterCost(size);
     }
+    e.addData("min cluster size", minSize);
+    e.addData("max cluster size", maxSize);
+    e.addData("avg cluster size", totalSize / clusters.size());
+    // The cost of the most expensive cluster relative to the average cost in percent
+    e.addData("cluster cost imbalance", std::lround(100 * maxCost * clusters.size() / totalCost));
   }
-
-  e.addData("n clusters", _clusters.size());
   // Log the average number of resulting clusters
-  PRECICE_DEBUG("Partition of unity data mapping between mesh \"{}\" and mesh \"{}\": mesh \"{}\" on rank {} was decomposed into {} clusters.", this->input()->getName(), this->output()->getName(), inMesh->getName(), utils::IntraComm::getRank(), _clusters.size());
+  PRECICE_DEBUG("Partition of unity data mapping between mesh \"{}\" and mesh \"{}\": mesh \"{}\" on rank {} was decomposed into {} clusters.", this->input()->getName(), this->output()->getName(), inMesh->getName(), utils::IntraComm::getRank(), clusters.size());
 
-  if (_clusters.size() > 0) {
-    PRECICE_DEBUG("Average number of vertices per cluster {}", std::accumulate(_clusters.begin(), _clusters.end(), static_cast<unsigned int>(0), [](auto &acc, auto &val) { return acc += val.getNumberOfInputVertices(); }) / _clusters.size());
-    PRECICE_DEBUG("Maximum number of vertices per cluster {}", std::max_element(_clusters.begin(), _clusters.end(), [](auto &v1, auto &v2) { return v1.getNumberOfInputVertices() < v2.getNumberOfInputVertices(); })->getNumberOfInputVertices());
-    PRECICE_DEBUG("Minimum number of vertices per cluster {}", std::min_element(_clusters.begin(), _clusters.end(), [](auto &v1, auto &v2) { return v1.getNumberOfInputVertices() < v2.getNumberOfInputVertices(); })->getNumberOfInputVertices());
+  if (clusters.size() > 0) {
+    PRECICE_DEBUG("Average number of vertices per cluster {}", std::accumulate(clusters.begin(), clusters.end(), static_cast<unsigned int>(0), [](auto &acc, auto &val) { return acc += val.getNumberOfInputVertices(); }) / clusters.size());
+    PRECICE_DEBUG("Maximum number of vertices per cluster {}", std::max_element(clusters.begin(), clusters.end(), [](auto &v1, auto &v2) { return v1.getNumberOfInputVertices() < v2.getNumberOfInputVertices(); })->getNumberOfInputVertices());
+    PRECICE_DEBUG("Minimum number of vertices per cluster {}", std::min_element(clusters.begin(), clusters.end(), [](auto &v1, auto &v2) { return v1.getNumberOfInputVertices() < v2.getNumberOfInputVertices(); })->getNumberOfInputVertices());
   }
 
   precice::profiling::Event eWeights("map.pou.computeMapping.computeWeights");
@@ -208,55 +322,70 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   // Step 3: index the clusters / the center mesh in order to define the output vertex -> cluster ownership
   // the ownership is required to compute the normalized partition of unity weights (Step 4)
   query::Index clusterIndex(centerMesh);
+  clusterIndex.buildVertexGrids({_clusterRadius});
   // Step 4: find all clusters the output vertex lies in, i.e., find all cluster centers which have the distance of a cluster radius from the given output vertex
-  // Here, we do this using the RTree on the centerMesh: VertexID (queried from the centersMesh) == clusterID, by construction above. The loop uses
+  // Here, we do this using the index of the centerMesh: VertexID (queried from the centersMesh) == clusterID, by construction above. The loop uses
   // the vertices to compute the weights required for the partition of unity data mapping.
   // Note: this could also be done on-the-fly in the map data phase for dynamic queries, which would require to make the mesh as well as the indexTree member variables.
   PRECICE_DEBUG("Computing cluster-vertex association");
-  for (const auto &vertex : outMesh->vertices()) {
-    // Step 4a: get the relevant clusters for the output vertex
-    auto       clusterIDs            = clusterIndex.getVerticesInsideBox(vertex, _clusterRadius);
-    const auto localNumberOfClusters = clusterIDs.size();
-
-    // Consider the case where we didn't find any cluster (meshes don't match very well)
-    //
-    // In principle, we could assign the vertex to the closest cluster using clusterIDs.emplace_back(clusterIndex.getClosestVertex(vertex.getCoords()).index);
-    // However, this leads to a conflict with weights already set in the corresponding cluster, since we insert the ID and, later on, map the ID to a local weight index
-    // Of course, we could rearrange the weights, but we want to avoid the case here anyway, i.e., prefer to abort.
-    PRECICE_CHECK(localNumberOfClusters > 0,
-                  "Output vertex {} of mesh \"{}\" could not be assigned to any cluster in the rbf-pum mapping. This probably means that the meshes do not match well geometry-wise: Visualize the exported preCICE meshes to confirm."
-                  " If the meshes are fine geometry-wise, you can try to increase the number of \"vertices-per-cluster\" (default is 50), the \"relative-overlap\" (default is 0.15),"
-                  " or disable the option \"project-to-input\"."
-                  "These options are only valid for the <mapping:rbf-pum-direct/> tag.",
-                  vertex.getCoords(), outMesh->getName());
-
-    // Next we compute the normalized weights of each output vertex for each partition
-    PRECICE_ASSERT(localNumberOfClusters > 0, "No cluster found for vertex {}", vertex.getCoords());
-
-    // Step 4b: compute the weight in each partition individually and store them in 'weights'
-    std::vector<double> weights(localNumberOfClusters);
-    std::transform(clusterIDs.cbegin(), clusterIDs.cend(), weights.begin(), [&](const auto &ids) { return _clusters[ids].computeWeight(vertex); });
-    double weightSum = std::accumulate(weights.begin(), weights.end(), static_cast<double>(0.));
-    // TODO: This covers the edge case of vertices being at the edge of (several) clusters
-    // In case the sum is equal to zero, we assign equal weights for all clusters
-    if (weightSum <= 0) {
-      PRECICE_ASSERT(weights.size() > 0);
-      std::for_each(weights.begin(), weights.end(), [&weights](auto &w) { w = 1. / weights.size(); });
-      weightSum = 1;
+  // The vertices are processed concurrently: each vertex sets only its own weights in the clusters
+  const auto &outVertices = outMesh->vertices();
+  utils::parallelForChunks(outVertices.size(), utils::chunkCount(outVertices.size(), minVerticesPerThread, _nThreads), [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (std::size_t v = begin; v < end; ++v) {
+      const auto &vertex = outVertices[v];
+      // Step 4a: get the relevant clusters for the output vertex
+      auto clusterIDs = clusterIndex.getVerticesInsideBox(vertex, _clusterRadius);
+      // Clusters with a smaller radius than the query radius might not contain the vertex, where the output vertices of a cluster exclude its edge
+      clusterIDs.erase(std::remove_if(clusterIDs.begin(), clusterIDs.end(), [&](VertexID id) {
+                         const auto &cluster = clusters[id];
+                         return cluster.getRadius() < _clusterRadius &&
+                                computeSquaredDifference(cluster.getCenterCoords(), vertex.rawCoords()) >= math::pow_int<2>(cluster.getRadius() - math::NUMERICAL_ZERO_DIFFERENCE);
+                       }),
+                       clusterIDs.end());
+      const auto localNumberOfClusters = clusterIDs.size();
+
+      // Consider the case where we didn't find any cluster (meshes don't match very well)
+      //
+      // In principle, we could assign the vertex to the closest cluster using clusterIDs.emplace_back(clusterIndex.getClosestVertex(vertex.getCoords()).index);
+      // However, this leads to a conflict with weights already set in the corresponding cluster, since we insert the ID and, later on, map the ID to a local weight index
+      // Of course, we could rearrange the weights, but we want to avoid the case here anyway, i.e., prefer to abort.
+      PRECICE_CHECK(localNumberOfClusters > 0,
+                    "Output vertex {} of mesh \"{}\" could not be assigned to any cluster in the rbf-pum mapping. This probably means that the meshes do not match well geometry-wise: Visualize the exported preCICE meshes to confirm."
+                    " If the meshes are fine geometry-wise, you can try to increase the number of \"vertices-per-cluster\" (default is 50), the \"relative-overlap\" (default is 0.15),"
+                    " or disable the option \"project-to-input\"."
+                    "These options are only valid for the <mapping:rbf-pum-direct/> tag.",
+                    vertex.getCoords(), outMesh->getName());
+
+      // Next we compute the normalized weights of each output vertex for each partition
+      PRECICE_ASSERT(localNumberOfClusters > 0, "No cluster found for vertex {}", vertex.getCoords());
+
+      // Step 4b: compute the weight in each partition individually and store them in 'weights'
+      std::vector<double> weights(localNumberOfClusters);
+      std::transform(clusterIDs.cbegin(), clusterIDs.cend(), weights.begin(), [&](const auto &ids) { return clusters[ids].computeWeight(vertex); });
+      double weightSum = std::accumulate(weights.begin(), weights.end(), static_cast<double>(0.));
+      // TODO: This covers the edge case of vertices being at the edge of (several) clusters
+      // In case the sum is equal to zero, we assign equal weights for all clusters
+      if (weightSum <= 0) {
+        PRECICE_ASSERT(weights.size() > 0);
+        std::for_each(weights.begin(), weights.end(), [&weights](auto &w) { w = 1. / weights.size(); });
+        weightSum = 1;
+      }
+      PRECICE_ASSERT(weightSum > 0);
+
+      // Step 4c: scale the weight using the weight sum and store the normalized weight in all associated clusters
+      for (unsigned int i = 0; i < localNumberOfClusters; ++i) {
+        PRECICE_ASSERT(clusterIDs[i] < static_cast<int>(clusters.size()));
+        clusters[clusterIDs[i]].setNormalizedWeight(weights[i] / weightSum, vertex.getID());
+      }
     }
-    PRECICE_ASSERT(weightSum > 0);
-
-    // Step 4c: scale the weight using the weight sum and store the normalized weight in all associated clusters
-    for (unsigned int i = 0; i < localNumberOfClusters; ++i) {
-      PRECICE_ASSERT(clusterIDs[i] < static_cast<int>(_clusters.size()));
-      _clusters[clusterIDs[i]].setNormalizedWeight(weights[i] / weightSum, vertex.getID());
-    }
-  }
+  });
   eWeights.stop();
 
   // Uncomment to add a VTK export of the cluster center distribution for visualization purposes
   // exportClusterCentersAsVTU(centerMesh);
 
+  _clusters = std::move(sharedClusters);
+  this->shareOperator(_clusters);
   this->_hasComputedMapping = true;
 }
 
@@ -272,7 +401,7 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(const tim
   PRECICE_ASSERT(outData.isZero());
 
   // 2. Iterate over all clusters and accumulate the result in the output data
-  std::for_each(_clusters.begin(), _clusters.end(), [&](auto &cluster) { cluster.mapConservative(inData, outData); });
+  evaluateClusters(outData, [&](const auto &cluster, Eigen::VectorXd &result) { cluster.mapConservative(inData, result); });
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
@@ -287,7 +416,33 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(const time:
   PRECICE_ASSERT(outData.isZero());
 
   // 2. Execute the actual mapping evaluation in all vertex clusters and accumulate the data
-  std::for_each(_clusters.begin(), _clusters.end(), [&](auto &clusters) { clusters.mapConsistent(inData, outData); });
+  evaluateClusters(outData, [&](const auto &cluster, Eigen::VectorXd &result) { cluster.mapConsistent(inData, result); });
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename Func>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::evaluateClusters(Eigen::VectorXd &outData, Func &&evaluate) const
+{
+  PRECICE_ASSERT(_clusters);
+  const auto &clusters = _clusters->clusters;
+  const auto  nChunks  = utils::chunkCount(clusters.size(), minClustersPerThread, _nThreads);
+  if (nChunks == 1) {
+    std::for_each(clusters.begin(), clusters.end(), [&](const auto &cluster) { evaluate(cluster, outData); });
+    return;
+  }
+
+  // Clusters overlap, hence, each chunk of clusters accumulates into a separate buffer. The buffers are reduced
+  // in the order of the chunks, which keeps the result independent of the thread scheduling.
+  std::vector<Eigen::VectorXd> results(nChunks - 1, Eigen::VectorXd::Zero(outData.size()));
+  utils::parallelForChunks(clusters.size(), nChunks, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+    Eigen::VectorXd &result = (chunk == 0) ? outData : results[chunk - 1];
+    for (std::size_t i = begin; i < end; ++i) {
+      evaluate(clusters[i], result);
+    }
+  });
+  for (const auto &result : results) {
+    outData += result;
+  }
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
@@ -347,8 +502,8 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshFirstRound()
 
   // Get the local bounding boxes
   auto localBB = outMesh->getBoundingBox();
-  // Now we extend the bounding box by the radius
-  localBB.expandBy(2 * _clusterRadius);
+  // Now we extend the bounding box by the radius, where balanced clusters grow up to maxClusterGrowth times the estimate
+  localBB.expandBy(2 * (_balanceClusters ? impl::maxClusterGrowth : 1.) * _clusterRadius);
 
   // ... and tag all affected vertices
   auto verticesNew = filterMesh->index().getVerticesInsideBox(localBB);
@@ -371,8 +526,8 @@ void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::exportClusterCentersAsVTU
   auto dataCardinality = centerMesh.createData("number-of-vertices", 1, -1);
   centerMesh.allocateDataValues();
   dataRadius->values().fill(_clusterRadius);
-  for (unsigned int i = 0; i < _clusters.size(); ++i) {
-    dataCardinality->values()[i] = static_cast<double>(_clusters[i].getNumberOfInputVertices());
+  for (unsigned int i = 0; i < _clusters->clusters.size(); ++i) {
+    dataCardinality->values()[i] = static_cast<double>(_clusters->clusters[i].getNumberOfInputVertices());
   }
 
   // We have to create the global offsets in order to export things in parallel
@@ -415,10 +570,14 @@ template <typename RADIAL_BASIS_FUNCTION_T>
 void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::clear()
 {
   PRECICE_TRACE();
-  _clusters.clear();
+  this->releaseSharedOperator(_clusters.get());
+  _clusters.reset();
   // TODO: Don't reset this here
   _clusterRadius            = 0;
   this->_hasComputedMapping = false;
+  // The clustering queries both meshes, whose vertices might have moved since
+  this->input()->index().clear();
+  this->output()->index().clear();
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
@@ -1,7 +1,7 @@
 #pragma once
 
+#include <boost/container/static_vector.hpp>
 #include <iosfwd>
-#include <vector>
 #include "Eigen/Core"
 #include "mesh/Edge.hpp"
 #include "mesh/Tetrahedron.hpp"
@@ -17,6 +17,9 @@ struct WeightedElement {
   double weight;
 };
 
+/// The weights of a polation, which are at most the 4 vertices of a tetrahedron and thus stored in place
+using WeightedElements = boost::container::static_vector<WeightedElement, 4>;
+
 /**
  * @brief Calculates the barycentric coordinates of a coordinate on the given vertex/edge/triangle and stores the corresponding weights
  * If all barycentric coordinates are positive, the operation is interpolation. If not, it is an extrapolation.
@@ -36,7 +39,7 @@ public:
   Polation(const Eigen::VectorXd &location, const mesh::Tetrahedron &element);
 
   /// Get the weights and indices of the calculated interpolation
-  const std::vector<WeightedElement> &getWeightedElements() const;
+  const WeightedElements &getWeightedElements() const;
 
   /// Check whether all the weights are positive, which means it is interpolation
   bool isInterpolation() const;
@@ -45,8 +48,8 @@ public:
   double distance() const;
 
 private:
-  std::vector<WeightedElement> _weightedElements;
-  double                       _distance;
+  WeightedElements _weightedElements;
+  double           _distance;
 };
 
 /// Make the WeightedElement printable
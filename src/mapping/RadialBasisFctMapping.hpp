@@ -2,6 +2,8 @@
 
 #include <Eigen/Cholesky>
 #include <Eigen/Core>
+#include <tuple>
+#include <type_traits>
 
 #include "com/Communication.hpp"
 #include "com/Extra.hpp"
@@ -58,8 +60,8 @@ public:
 private:
   precice::logging::Logger _log{"mapping::RadialBasisFctMapping"};
 
-  // The actual solver
-  std::unique_ptr<SOLVER_T> _rbfSolver;
+  // The actual solver, which may be shared with an equivalent mapping
+  std::shared_ptr<SOLVER_T> _rbfSolver;
 
   /// @copydoc RadialBasisFctBaseMapping::mapConservative
   void mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) final override;
@@ -67,6 +69,12 @@ private:
   /// @copydoc RadialBasisFctBaseMapping::mapConsistent
   void mapConsistent(const time::Sample &inData, Eigen::VectorXd &outData) final override;
 
+  /// @copydoc Mapping::mapConservativeBatch
+  void mapConservativeBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData) final override;
+
+  /// @copydoc Mapping::mapConsistentBatch
+  void mapConsistentBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData) final override;
+
   /// Treatment of the polynomial
   Polynomial _polynomial;
 
@@ -154,13 +162,20 @@ void RadialBasisFctMapping<SOLVER_T, Args...>::computeMapping()
       globalOutMesh.addMesh(*outMesh);
     }
 
-    // Forwarding the tuples here requires some template magic I don't want to implement
-    if constexpr (std::tuple_size_v<std::tuple<Args...>>> 0) {
-      _rbfSolver = std::make_unique<SOLVER_T>(this->_basisFunction, globalInMesh, boost::irange<Eigen::Index>(0, globalInMesh.nVertices()),
-                                              globalOutMesh, boost::irange<Eigen::Index>(0, globalOutMesh.nVertices()), this->_deadAxis, _polynomial, std::get<0>(optionalArgs));
+    // An equivalent mapping in the opposite direction solves the same system
+    auto sharedSolver = this->template findSharedOperator<SOLVER_T>();
+    if (sharedSolver && sharedSolver->getInputSize() == static_cast<Eigen::Index>(globalInMesh.nVertices()) &&
+        sharedSolver->getOutputSize() == static_cast<Eigen::Index>(globalOutMesh.nVertices())) {
+      PRECICE_DEBUG("Reusing the solver of an equivalent mapping.");
+      _rbfSolver = std::move(sharedSolver);
     } else {
-      _rbfSolver = std::make_unique<SOLVER_T>(this->_basisFunction, globalInMesh, boost::irange<Eigen::Index>(0, globalInMesh.nVertices()),
-                                              globalOutMesh, boost::irange<Eigen::Index>(0, globalOutMesh.nVertices()), this->_deadAxis, _polynomial);
+      // The optional arguments are appended to the solver arguments
+      auto createSolver = [&](const auto &... args) {
+        return std::make_shared<SOLVER_T>(this->_basisFunction, globalInMesh, boost::irange<Eigen::Index>(0, globalInMesh.nVertices()),
+                                          globalOutMesh, boost::irange<Eigen::Index>(0, globalOutMesh.nVertices()), this->_deadAxis, _polynomial, args...);
+      };
+      _rbfSolver = std::apply(createSolver, optionalArgs);
+      this->shareOperator(_rbfSolver);
     }
   }
   this->_hasComputedMapping = true;
@@ -171,6 +186,7 @@ template <typename SOLVER_T, typename... Args>
 void RadialBasisFctMapping<SOLVER_T, Args...>::clear()
 {
   PRECICE_TRACE();
+  this->releaseSharedOperator(_rbfSolver.get());
   _rbfSolver.reset();
   this->_hasComputedMapping = false;
 }
@@ -178,7 +194,7 @@ void RadialBasisFctMapping<SOLVER_T, Args...>::clear()
 template <typename SOLVER_T, typename... Args>
 std::string RadialBasisFctMapping<SOLVER_T, Args...>::getName() const
 {
-  if constexpr (std::tuple_size_v<std::tuple<Args...>>> 0) {
+  if constexpr (std::is_same_v<std::tuple<Args...>, std::tuple<MappingConfiguration::GinkgoParameter>>) {
     auto        param = std::get<0>(optionalArgs);
     std::string exec  = param.executor;
     if (param.solver == "qr-solver") {
@@ -253,24 +269,13 @@ void RadialBasisFctMapping<SOLVER_T, Args...>::mapConservative(const time::Sampl
     Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
     Eigen::VectorXd             outputValues((this->output()->getGlobalNumberOfVertices()) * valueDim);
 
-    Eigen::VectorXd in;                     // rows == outputSize
-    in.resize(_rbfSolver->getOutputSize()); // rows == outputSize
-
-    outputValues.setZero();
+    // Every data component is one column, such that all components are mapped in a single batched solve
+    Eigen::MatrixXd in = Eigen::Map<const Eigen::MatrixXd>(inputValues.data(), valueDim, _rbfSolver->getOutputSize()).transpose(); // rows == outputSize
 
-    for (int dim = 0; dim < valueDim; dim++) {
-      for (int i = 0; i < in.size(); i++) { // Fill input data values
-        in[i] = inputValues(i * valueDim + dim);
-      }
-
-      Eigen::VectorXd out;
-      out = _rbfSolver->solveConservative(in, _polynomial);
+    Eigen::MatrixXd out = _rbfSolver->solveConservative(in, _polynomial);
 
-      // Copy mapped data to output data values
-      for (int i = 0; i < this->output()->getGlobalNumberOfVertices(); i++) {
-        outputValues[i * valueDim + dim] = out[i];
-      }
-    }
+    // Copy mapped data to output data values
+    Eigen::Map<Eigen::MatrixXd>(outputValues.data(), valueDim, this->output()->getGlobalNumberOfVertices()) = out.topRows(this->output()->getGlobalNumberOfVertices()).transpose();
 
     // Data scattering to secondary ranks
     if (utils::IntraComm::isPrimary()) {
@@ -364,34 +369,17 @@ void RadialBasisFctMapping<SOLVER_T, Args...>::mapConsistent(const time::Sample
       outValuesSize.push_back(outData.size());
     }
 
-    Eigen::VectorXd in;
-
-    in.resize(_rbfSolver->getInputSize()); // rows == n
-    in.setZero();
-
-    // Construct Eigen vectors
-    Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
+    // Every data component is one column, such that all components are mapped in a single batched solve
+    Eigen::MatrixXd in = Eigen::MatrixXd::Zero(_rbfSolver->getInputSize(), valueDim); // rows == n
 
-    Eigen::VectorXd outputValues;
-    outputValues.resize((_rbfSolver->getOutputSize()) * valueDim);
+    // Fill input from input data values (last polyparams entries remain zero)
+    in.topRows(this->input()->getGlobalNumberOfVertices()) = Eigen::Map<const Eigen::MatrixXd>(globalInValues.data(), valueDim, this->input()->getGlobalNumberOfVertices()).transpose();
 
-    Eigen::VectorXd out;
-    outputValues.setZero();
+    Eigen::MatrixXd out = _rbfSolver->solveConsistent(in, _polynomial);
 
-    // For every data dimension, perform mapping
-    for (int dim = 0; dim < valueDim; dim++) {
-      // Fill input from input data values (last polyparams entries remain zero)
-      for (int i = 0; i < this->input()->getGlobalNumberOfVertices(); i++) {
-        in[i] = inputValues[i * valueDim + dim];
-      }
-
-      out = _rbfSolver->solveConsistent(in, _polynomial);
-
-      // Copy mapped data to output data values
-      for (int i = 0; i < out.size(); i++) {
-        outputValues[i * valueDim + dim] = out[i];
-      }
-    }
+    // Copy mapped data to output data values
+    Eigen::VectorXd outputValues(out.size());
+    Eigen::Map<Eigen::MatrixXd>(outputValues.data(), valueDim, out.rows()) = out.transpose();
 
     outData = Eigen::Map<Eigen::VectorXd>(outputValues.data(), outValuesSize.at(0));
 
@@ -411,5 +399,70 @@ void RadialBasisFctMapping<SOLVER_T, Args...>::mapConsistent(const time::Sample
     outData                            = Eigen::Map<Eigen::VectorXd>(receivedValues.data(), receivedValues.size());
   }
 }
+
+template <typename SOLVER_T, typename... Args>
+void RadialBasisFctMapping<SOLVER_T, Args...>::mapConservativeBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData)
+{
+  // The parallel case gathers the data on the primary rank, hence we map sample by sample
+  if (utils::IntraComm::isParallel()) {
+    Mapping::mapConservativeBatch(inData, outData);
+    return;
+  }
+
+  PRECICE_TRACE();
+  precice::profiling::Event e("map.rbf.mapData.From" + this->input()->getName() + "To" + this->output()->getName(), profiling::Synchronize);
+
+  PRECICE_DEBUG("Map conservative using {} for {} samples", getName(), inData.size());
+
+  const int          valueDim   = inData.front()->dataDims;
+  const Eigen::Index inputSize  = this->input()->nVertices();
+  const Eigen::Index outputSize = this->output()->nVertices();
+  PRECICE_ASSERT(inputSize == _rbfSolver->getOutputSize(), inputSize, _rbfSolver->getOutputSize());
+
+  // Every component of every sample is one column, such that all samples are mapped in a single batched solve
+  Eigen::MatrixXd in(inputSize, valueDim * inData.size());
+  for (std::size_t s = 0; s < inData.size(); ++s) {
+    in.middleCols(s * valueDim, valueDim) = Eigen::Map<const Eigen::MatrixXd>(inData[s]->values.data(), valueDim, inputSize).transpose();
+  }
+
+  Eigen::MatrixXd out = _rbfSolver->solveConservative(in, _polynomial);
+
+  for (std::size_t s = 0; s < inData.size(); ++s) {
+    Eigen::Map<Eigen::MatrixXd>(outData.col(s).data(), valueDim, outputSize) = out.block(0, s * valueDim, outputSize, valueDim).transpose();
+  }
+}
+
+template <typename SOLVER_T, typename... Args>
+void RadialBasisFctMapping<SOLVER_T, Args...>::mapConsistentBatch(const std::vector<const time::Sample *> &inData, Eigen::MatrixXd &outData)
+{
+  // The parallel case gathers the data on the primary rank, hence we map sample by sample
+  if (utils::IntraComm::isParallel()) {
+    Mapping::mapConsistentBatch(inData, outData);
+    return;
+  }
+
+  PRECICE_TRACE();
+  precice::profiling::Event e("map.rbf.mapData.From" + this->input()->getName() + "To" + this->output()->getName(), profiling::Synchronize);
+
+  PRECICE_DEBUG("Map {} using {} for {} samples", (this->hasConstraint(Mapping::CONSISTENT) ? "consistent" : "scaled-consistent"), getName(), inData.size());
+
+  const int          valueDim   = inData.front()->dataDims;
+  const Eigen::Index inputSize  = this->input()->nVertices();
+  const Eigen::Index outputSize = this->output()->nVertices();
+  PRECICE_ASSERT(outputSize == _rbfSolver->getOutputSize(), outputSize, _rbfSolver->getOutputSize());
+
+  // Every component of every sample is one column, such that all samples are mapped in a single batched solve
+  // The last polyparams rows remain zero
+  Eigen::MatrixXd in = Eigen::MatrixXd::Zero(_rbfSolver->getInputSize(), valueDim * inData.size());
+  for (std::size_t s = 0; s < inData.size(); ++s) {
+    in.block(0, s * valueDim, inputSize, valueDim) = Eigen::Map<const Eigen::MatrixXd>(inData[s]->values.data(), valueDim, inputSize).transpose();
+  }
+
+  Eigen::MatrixXd out = _rbfSolver->solveConsistent(in, _polynomial);
+
+  for (std::size_t s = 0; s < inData.size(); ++s) {
+    Eigen::Map<Eigen::MatrixXd>(outData.col(s).data(), valueDim, outputSize) = out.middleCols(s * valueDim, valueDim).transpose();
+  }
+}
 } // namespace mapping
 } // namespace precice
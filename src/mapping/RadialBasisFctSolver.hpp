@@ -3,15 +3,26 @@
 #include <Eigen/Cholesky>
 #include <Eigen/QR>
 #include <Eigen/SVD>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/irange.hpp>
+#include <limits>
+#include <memory>
 #include <numeric>
 #include <type_traits>
+#include <utility>
+#include <vector>
+#include "logging/LogMacros.hpp"
 #include "mapping/MathHelper.hpp"
 #include "mapping/config/MappingConfigurationTypes.hpp"
+#include "mapping/impl/HierarchicalMatrix.hpp"
+#include "math/constants.hpp"
 #include "mesh/Mesh.hpp"
 #include "precice/impl/Types.hpp"
 #include "profiling/Event.hpp"
+#include "query/Index.hpp"
+#include "utils/Threading.hpp"
 
 namespace precice {
 namespace mapping {
@@ -21,12 +32,32 @@ namespace mapping {
  * The class uses a dense matrix decomposition in order to decompose the resulting system(s) and a backward substitution
  * in order to solve the system at runtime. The functionality uses Eigen and supports only serial execution. In case
  * the polynomial="separate" option is used, the polynomial system is solved using a QR decomposition.
+ *
+ * For basis functions with compact support, the matrices are assembled in a sparse format if their fill ratio is low enough.
+ * Neighboring vertices are then found using the spatial index of the meshes and the interpolation matrix is decomposed
+ * using a sparse Cholesky decomposition with a fill-reducing ordering.
+ *
+ * Dense systems can optionally be decomposed in single precision (FactorizationPrecision::MIXED), which speeds up the
+ * decomposition. The solution is then refined iteratively, where the residuals are computed in double precision using
+ * the stored double-precision interpolation matrix.
+ *
+ * Alternatively, dense systems can be compressed hierarchically (compressionTolerance > 0): the interpolation matrix is
+ * approximated by a HODLR matrix with a direct solver and the evaluation matrix by a hierarchical matrix, where the
+ * low-rank blocks are computed using adaptive cross approximation. Both require O(n log n) memory instead of O(n^2).
+ *
+ * For dense systems, the evaluation matrix can optionally be applied matrix-free (matrixFree): instead of storing it,
+ * its entries are recomputed in cache-sized tiles whenever data is mapped. The tiles are processed on multiple threads.
+ *
+ * For strictly positive definite basis functions, the centers can optionally be reduced to a subset of the input vertices
+ * (greedyTolerance > 0), which is selected using the P-greedy algorithm. The interpolation system then becomes an
+ * overdetermined least-squares system, which is solved using a QR decomposition.
  */
 template <typename RADIAL_BASIS_FUNCTION_T>
 class RadialBasisFctSolver {
 public:
-  using DecompositionType = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), Eigen::LLT<Eigen::MatrixXd>, Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>;
-  using BASIS_FUNCTION_T  = RADIAL_BASIS_FUNCTION_T;
+  using DecompositionType             = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), Eigen::LLT<Eigen::MatrixXd>, Eigen::ColPivHouseholderQR<Eigen::MatrixXd>>;
+  using LowPrecisionDecompositionType = std::conditional_t<RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), Eigen::LLT<Eigen::MatrixXf>, Eigen::ColPivHouseholderQR<Eigen::MatrixXf>>;
+  using BASIS_FUNCTION_T              = RADIAL_BASIS_FUNCTION_T;
   /// Default constructor
   RadialBasisFctSolver() = default;
 
@@ -36,10 +67,26 @@ public:
    * for consistent mappings and the output mesh for conservative mappings
    * outputMesh refers to the mesh where we evaluate the interpolants, i.e., the output mesh
    * consistent mappings and the input mesh for conservative mappings
+   * Both meshes are non-const, as the sparse assembly queries their spatial index
+   * precision selects the precision of the decomposition, which is ignored for sparse systems
+   * compressionTolerance enables the hierarchical compression with the given relative accuracy if it is positive,
+   * which is ignored for sparse systems
+   * matrixFree recomputes the evaluation matrix on the fly using nThreads threads (0 uses all hardware threads),
+   * which is ignored for sparse systems
+   * greedyTolerance selects a subset of the input vertices as centers if it is positive, such that the relative power function
+   * of the centers is below the tolerance
+   *
+   * At most one of the sparse, mixed-precision, hierarchical and greedy modes is active. Only the sparse mode is selected
+   * automatically and takes precedence over the mixed precision and the hierarchical compression. Unsupported combinations
+   * of the options are rejected by the MappingConfiguration:
+   * - the hierarchical compression cannot be combined with the integrated polynomial, mixed precision or matrixFree
+   * - the greedy selection cannot be combined with the integrated polynomial or any of the other options
    */
   template <typename IndexContainer>
-  RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
-                       const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial);
+  RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                       mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial,
+                       FactorizationPrecision precision = FactorizationPrecision::DOUBLE, double compressionTolerance = 0.,
+                       bool matrixFree = false, unsigned int nThreads = 1, double greedyTolerance = 0.);
 
   /// Maps the given input data
   Eigen::VectorXd solveConsistent(Eigen::VectorXd &inputData, Polynomial polynomial) const;
@@ -47,6 +94,12 @@ public:
   /// Maps the given input data
   Eigen::VectorXd solveConservative(const Eigen::VectorXd &inputData, Polynomial polynomial) const;
 
+  /// Maps multiple right-hand sides at once, where each column of inputData is one right-hand side, e.g., one data component
+  Eigen::MatrixXd solveConsistent(Eigen::MatrixXd &inputData, Polynomial polynomial) const;
+
+  /// Maps multiple right-hand sides at once, where each column of inputData is one right-hand side, e.g., one data component
+  Eigen::MatrixXd solveConservative(const Eigen::MatrixXd &inputData, Polynomial polynomial) const;
+
   // Clear all stored matrices
   void clear();
 
@@ -56,13 +109,108 @@ public:
   // Returns the size of the input data
   Eigen::Index getOutputSize() const;
 
+  /// Returns true if the system is assembled and decomposed in a sparse format
+  bool isSparse() const;
+
+  /// Returns true if the system is decomposed in single precision and solved using iterative refinement
+  bool isMixedPrecision() const;
+
+  /// Returns true if the matrices are compressed hierarchically
+  bool isHierarchical() const;
+
+  /// Returns true if the evaluation matrix is recomputed on the fly instead of being stored
+  bool isMatrixFree() const;
+
+  /// Returns the number of greedily selected centers, or the input size if the centers are not selected greedily
+  Eigen::Index getNumberOfCenters() const;
+
 private:
   mutable precice::logging::Logger _log{"mapping::RadialBasisFctSolver"};
 
+  /// Maximum ratio of non-zero entries in the interpolation matrix, up to which the sparse format is used
+  static constexpr double maxSparseFillRatio = 0.1;
+
+  /// Maximum number of iterative refinement steps of mixed-precision solves
+  static constexpr int maxRefinementSteps = 10;
+
+  /// Relative residual at which the iterative refinement stops
+  static constexpr double refinementTolerance = 1e-14;
+
+  /// Relative residual above which a refined solution is considered inaccurate
+  static constexpr double maxRefinementResidual = 1e-6;
+
+  /// Maximum number of vertices in the leaves of the cluster trees of hierarchical matrices
+  static constexpr Eigen::Index hierarchicalLeafSize = 64;
+
+  /// Number of output (rows) and input (columns) vertices of the tiles of the matrix-free evaluation, such that a tile fits into the L2 cache
+  static constexpr Eigen::Index evaluationTileRows = 128;
+  static constexpr Eigen::Index evaluationTileCols = 128;
+
   double evaluateRippaLOOCVerror(const Eigen::VectorXd &lambda) const;
+
+  /// Whether the LOOCV error is computed, which requires the inverse diagonal of the dense double-precision decomposition
+  bool computesCrossValidation(Polynomial polynomial) const;
+
+  /// Solves the interpolation system for all columns of rhs
+  template <typename MatrixType>
+  MatrixType solveInterpolationSystem(const MatrixType &rhs) const;
+
+  /// Applies the transposed solution operator of the interpolation system, which differs from solveInterpolationSystem() for greedily selected centers only
+  template <typename MatrixType>
+  MatrixType solveTransposedInterpolationSystem(const MatrixType &rhs) const;
+
+  /// Solves the interpolation system using the single-precision decomposition and iterative refinement
+  template <typename MatrixType>
+  MatrixType solveMixedPrecision(const MatrixType &rhs) const;
+
+  /// Computes A * coefficients
+  template <typename MatrixType>
+  MatrixType applyEvaluationMatrix(const MatrixType &coefficients) const;
+
+  /// Computes A^T * data
+  template <typename MatrixType>
+  MatrixType applyTransposedEvaluationMatrix(const MatrixType &data) const;
+
+  /// Computes the top left rows x cols corner of tile, which holds the kernel of the evaluation matrix starting at the given output and input vertex
+  /// squaredDistances is a buffer of at least rows entries
+  void evaluateTile(Eigen::Index rowBegin, Eigen::Index colBegin, Eigen::Index rows, Eigen::Index cols, Eigen::MatrixXd &tile, Eigen::VectorXd &squaredDistances) const;
+
+  /// Computes A * coefficients without storing A
+  template <typename MatrixType>
+  MatrixType applyMatrixFreeEvaluationMatrix(const MatrixType &coefficients) const;
+
+  /// Computes A^T * data without storing A
+  template <typename MatrixType>
+  MatrixType applyMatrixFreeTransposedEvaluationMatrix(const MatrixType &data) const;
+
   /// Decomposition of the interpolation matrix
   DecompositionType _decMatrixC;
 
+  /// Sparse decomposition of the interpolation matrix, used instead of _decMatrixC if _sparse is set
+  /// Held by pointer, as Eigen's sparse decompositions are neither copyable nor movable
+  std::unique_ptr<Eigen::SimplicialLLT<Eigen::SparseMatrix<double>>> _sparseDecMatrixC;
+
+  /// Single-precision decomposition of the interpolation matrix, used instead of _decMatrixC for mixed precision
+  LowPrecisionDecompositionType _decMatrixCLowPrecision;
+
+  /// Whether _decMatrixCLowPrecision is used
+  bool _mixedPrecision = false;
+
+  /// Interpolation matrix in double precision, required for the residuals of the iterative refinement (for mixed precision)
+  Eigen::MatrixXd _matrixC;
+
+  /// Basis function to evaluate the evaluation matrix on the fly (for matrix-free)
+  /// Held by pointer, as some basis functions are not assignable
+  std::unique_ptr<RADIAL_BASIS_FUNCTION_T> _basisFunction;
+
+  /// Coordinates of the input vertices, see buildCoordinateMatrix() (for matrix-free)
+  Eigen::Matrix3Xd _inputCoordinates;
+
+  /// Hierarchical approximations of the interpolation and evaluation matrix, used if _hierarchical is set
+  impl::HODLRMatrix        _hierarchicalMatrixC;
+  impl::HierarchicalMatrix _hierarchicalMatrixA;
+  bool                     _hierarchical = false;
+
   /// Diagonal entris of the inverse matrix C, requires for the Rippa scheme
   Eigen::VectorXd _inverseDiagonal;
 
@@ -78,6 +226,31 @@ private:
   /// Evaluation matrix (output x input)
   Eigen::MatrixXd _matrixA;
 
+  /// Coordinates of the active axes of the output vertices, stored per axis to vectorize across output vertices (for matrix-free)
+  Eigen::MatrixXd _outputCoordinates;
+
+  /// Polynomial block of the evaluation matrix (for matrix-free and integrated polynomial)
+  Eigen::MatrixXd _outputPolynomial;
+
+  /// Whether the evaluation matrix is applied matrix-free instead of using _matrixA
+  bool _matrixFree = false;
+
+  /// Number of threads of the matrix-free evaluation
+  unsigned int _nThreads = 1;
+
+  /// Sparse evaluation matrix (output x input), used instead of _matrixA if _sparse is set
+  Eigen::SparseMatrix<double> _sparseMatrixA;
+
+  /// Whether the sparse matrices are used
+  bool _sparse = false;
+
+  /// Decomposition of the least-squares system (input x centers) of greedily selected centers, used instead of _decMatrixC if _greedy is set
+  /// The evaluation matrix _matrixA then refers to the centers only (output x centers)
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qrMatrixB;
+
+  /// Whether the centers are selected greedily
+  bool _greedy = false;
+
   bool computeCrossValidation = false;
 };
 
@@ -122,8 +295,8 @@ constexpr void reduceActiveAxis(const mesh::Mesh &mesh, const IndexContainer &ID
 }
 
 // Fill in the polynomial entries
-template <typename IndexContainer>
-inline void fillPolynomialEntries(Eigen::MatrixXd &matrix, const mesh::Mesh &mesh, const IndexContainer &IDs, Eigen::Index startIndex, std::array<bool, 3> activeAxis)
+template <typename MatrixType, typename IndexContainer>
+inline void fillPolynomialEntries(MatrixType &matrix, const mesh::Mesh &mesh, const IndexContainer &IDs, Eigen::Index startIndex, std::array<bool, 3> activeAxis)
 {
   // Loop over all vertices in the mesh
   for (const auto &i : IDs | boost::adaptors::indexed()) {
@@ -146,6 +319,59 @@ inline void fillPolynomialEntries(Eigen::MatrixXd &matrix, const mesh::Mesh &mes
   }
 }
 
+/// Gathers the coordinates of the active axes of the given vertices per axis, i.e., one column per active axis
+template <typename IndexContainer>
+Eigen::MatrixXd buildActiveCoordinates(const mesh::Mesh &mesh, const IndexContainer &IDs, std::array<bool, 3> activeAxis)
+{
+  Eigen::MatrixXd coordinates(IDs.size(), std::count(activeAxis.begin(), activeAxis.end(), true));
+  for (const auto &i : IDs | boost::adaptors::indexed()) {
+    const auto &coords = mesh.vertex(i.value()).rawCoords();
+    for (int d = 0, k = 0; d < 3; ++d) {
+      if (activeAxis[d]) {
+        coordinates(i.index(), k++) = coords[d];
+      }
+    }
+  }
+  return coordinates;
+}
+
+/// Calls f with the number of active axes as std::integral_constant, such that kernels can be specialized for it at compile time
+template <typename Func>
+void visitActiveDimensions(Eigen::Index dimensions, Func &&f)
+{
+  switch (dimensions) {
+  case 1:
+    f(std::integral_constant<int, 1>{});
+    break;
+  case 2:
+    f(std::integral_constant<int, 2>{});
+    break;
+  case 3:
+    f(std::integral_constant<int, 3>{});
+    break;
+  default:
+    PRECICE_UNREACHABLE("Unsupported number of active axes {}.", dimensions);
+  }
+}
+
+/// Computes the squared distances between u and the given range of vertices, whose coordinates are stored per axis
+template <int Dimensions>
+inline void computeSquaredDistances(const Eigen::MatrixXd &coordinates, Eigen::Index begin, Eigen::Index size,
+                                    const Eigen::Matrix<double, Dimensions, 1> &u, double *squaredDistances)
+{
+  PRECICE_ASSERT(coordinates.cols() == Dimensions, coordinates.cols());
+  const auto                 x = [&](int d) { return coordinates.col(d).segment(begin, size).array() - u[d]; };
+  Eigen::Map<Eigen::ArrayXd> r2(squaredDistances, size);
+  // A single pass over the vertices, which is vectorized across them
+  if constexpr (Dimensions == 1) {
+    r2 = x(0).square();
+  } else if constexpr (Dimensions == 2) {
+    r2 = x(0).square() + x(1).square();
+  } else {
+    r2 = x(0).square() + x(1).square() + x(2).square();
+  }
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T, typename IndexContainer>
 Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
                                std::array<bool, 3> activeAxis, Polynomial polynomial)
@@ -169,31 +395,29 @@ Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh
     matrixCLU.setZero();
   }
 
-  // Compute RBF matrix entries
-  auto         i_iter  = inputIDs.begin();
-  Eigen::Index i_index = 0;
-  for (; i_iter != inputIDs.end(); ++i_iter, ++i_index) {
-    const auto &u       = inputMesh.vertex(*i_iter).rawCoords();
-    auto        j_iter  = i_iter;
-    auto        j_index = i_index;
-    for (; j_iter != inputIDs.end(); ++j_iter, ++j_index) {
-      const auto &v                 = inputMesh.vertex(*j_iter).rawCoords();
-      double      squaredDifference = computeSquaredDifference(u, v, activeAxis);
-      matrixCLU(i_index, j_index)   = basisFunction.evaluate(std::sqrt(squaredDifference));
+  // Compute RBF matrix entries of the upper triangular part, where each column is evaluated as one batch
+  const Eigen::MatrixXd coordinates = buildActiveCoordinates(inputMesh, inputIDs, activeAxis);
+  Eigen::VectorXd       squaredDistances(inputSize);
+  visitActiveDimensions(coordinates.cols(), [&](auto dimensions) {
+    constexpr int dim = decltype(dimensions)::value;
+    for (Eigen::Index j = 0; j < static_cast<Eigen::Index>(inputSize); ++j) {
+      const std::size_t size = j + 1;
+      computeSquaredDistances<dim>(coordinates, 0, size, coordinates.row(j).transpose(), squaredDistances.data());
+      basisFunction.evaluate({squaredDistances.data(), size}, {matrixCLU.col(j).data(), size});
     }
-  }
+  });
 
   // Add potentially the polynomial contribution in the matrix
   if (polynomial == Polynomial::ON) {
     fillPolynomialEntries(matrixCLU, inputMesh, inputIDs, inputSize, activeAxis);
   }
-  matrixCLU.triangularView<Eigen::Lower>() = matrixCLU.transpose();
+  matrixCLU.template triangularView<Eigen::Lower>() = matrixCLU.transpose();
   return matrixCLU;
 }
 
-template <typename RADIAL_BASIS_FUNCTION_T, typename IndexContainer>
-Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
-                             const mesh::Mesh &outputMesh, const IndexContainer outputIDs, std::array<bool, 3> activeAxis, Polynomial polynomial)
+template <typename RADIAL_BASIS_FUNCTION_T, typename InputIndexContainer, typename OutputIndexContainer>
+Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const InputIndexContainer &inputIDs,
+                             const mesh::Mesh &outputMesh, const OutputIndexContainer &outputIDs, std::array<bool, 3> activeAxis, Polynomial polynomial)
 {
   // Treat the 2D case as 3D case with dead axis
   const unsigned int deadDimensions = std::count(activeAxis.begin(), activeAxis.end(), false);
@@ -209,15 +433,18 @@ Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::
 
   Eigen::MatrixXd matrixA(outputSize, n);
 
-  // Compute RBF values for matrix A
-  for (const auto &i : outputIDs | boost::adaptors::indexed()) {
-    const auto &u = outputMesh.vertex(i.value()).rawCoords();
-    for (const auto &j : inputIDs | boost::adaptors::indexed()) {
-      const auto &v                 = inputMesh.vertex(j.value()).rawCoords();
-      double      squaredDifference = computeSquaredDifference(u, v, activeAxis);
-      matrixA(i.index(), j.index()) = basisFunction.evaluate(std::sqrt(squaredDifference));
+  // Compute RBF values for matrix A, where each column is evaluated as one batch
+  const Eigen::MatrixXd inputCoordinates  = buildActiveCoordinates(inputMesh, inputIDs, activeAxis);
+  const Eigen::MatrixXd outputCoordinates = buildActiveCoordinates(outputMesh, outputIDs, activeAxis);
+  const std::size_t     batchSize         = outputSize;
+  Eigen::VectorXd       squaredDistances(outputSize);
+  visitActiveDimensions(inputCoordinates.cols(), [&](auto dimensions) {
+    constexpr int dim = decltype(dimensions)::value;
+    for (Eigen::Index j = 0; j < static_cast<Eigen::Index>(inputSize); ++j) {
+      computeSquaredDistances<dim>(outputCoordinates, 0, outputSize, inputCoordinates.row(j).transpose(), squaredDistances.data());
+      basisFunction.evaluate({squaredDistances.data(), batchSize}, {matrixA.col(j).data(), batchSize});
     }
-  }
+  });
 
   // Add potentially the polynomial contribution in the matrix
   if (polynomial == Polynomial::ON) {
@@ -226,6 +453,211 @@ Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::
   return matrixA;
 }
 
+/**
+ * @brief Selects a subset of the given vertices as RBF centers using the P-greedy algorithm
+ *
+ * Iteratively adds the vertex at which the power function of the current centers is maximal. The power function bounds
+ * the interpolation error for all functions of the native space of the basis function, such that the selection doesn't
+ * require any data. It is updated using the Newton basis of the centers. The selection stops once the power function,
+ * relative to its initial value, is below the tolerance everywhere. Requires a strictly positive definite basis function.
+ *
+ * @return the positions of the centers in the given coordinates, in the order of their selection
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<Eigen::Index> selectGreedyCenters(const RADIAL_BASIS_FUNCTION_T &basisFunction, const Eigen::MatrixXd &coordinates, double tolerance)
+{
+  static_assert(RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite());
+  const Eigen::Index n     = coordinates.rows();
+  const auto         size  = static_cast<std::size_t>(n);
+  const double       scale = basisFunction.evaluate(0.);
+
+  // The squared power function and the values of the Newton basis at all vertices
+  Eigen::VectorXd powerFunction = Eigen::VectorXd::Constant(n, scale);
+  Eigen::MatrixXd newtonBasis(n, std::min<Eigen::Index>(n, 16));
+  Eigen::VectorXd squaredDistances(n);
+  Eigen::VectorXd column(n);
+
+  std::vector<Eigen::Index> centers;
+  visitActiveDimensions(coordinates.cols(), [&](auto dimensions) {
+    constexpr int dim = decltype(dimensions)::value;
+    while (static_cast<Eigen::Index>(centers.size()) < n) {
+      Eigen::Index next;
+      const double maxPower = powerFunction.maxCoeff(&next);
+      if (maxPower <= math::pow_int<2>(tolerance) * scale) {
+        break;
+      }
+      const Eigen::Index k = centers.size();
+      if (k == newtonBasis.cols()) {
+        newtonBasis.conservativeResize(n, std::min(n, 2 * k));
+      }
+
+      // The next Newton basis function is the kernel translate orthogonalized against the previous ones
+      computeSquaredDistances<dim>(coordinates, 0, n, coordinates.row(next).transpose(), squaredDistances.data());
+      basisFunction.evaluate({squaredDistances.data(), size}, {column.data(), size});
+      column -= newtonBasis.leftCols(k) * newtonBasis.row(next).head(k).transpose();
+      newtonBasis.col(k) = column / std::sqrt(maxPower);
+
+      powerFunction -= newtonBasis.col(k).cwiseAbs2();
+      powerFunction(next) = 0;
+      centers.push_back(next);
+    }
+  });
+  return centers;
+}
+
+/// Sorted lookup table from vertex IDs to their position in the given IDs
+template <typename IndexContainer>
+std::vector<std::pair<VertexID, Eigen::Index>> buildLocalIndices(const IndexContainer &IDs)
+{
+  std::vector<std::pair<VertexID, Eigen::Index>> localIndices;
+  localIndices.reserve(IDs.size());
+  for (const auto &i : IDs | boost::adaptors::indexed()) {
+    localIndices.emplace_back(static_cast<VertexID>(i.value()), i.index());
+  }
+  std::sort(localIndices.begin(), localIndices.end());
+  return localIndices;
+}
+
+/// Returns the position of the vertex ID in the lookup table or -1 if the ID is not part of it
+inline Eigen::Index findLocalIndex(const std::vector<std::pair<VertexID, Eigen::Index>> &localIndices, VertexID id)
+{
+  auto match = std::lower_bound(localIndices.begin(), localIndices.end(), std::make_pair(id, Eigen::Index{0}),
+                                [](const auto &a, const auto &b) { return a.first < b.first; });
+  return (match != localIndices.end() && match->first == id) ? match->second : -1;
+}
+
+/// Gathers the coordinates of the given vertices column-wise, which is the input of the batch queries of query::Index
+template <typename IndexContainer>
+Eigen::MatrixXd gatherCoordinates(const mesh::Mesh &mesh, const IndexContainer &IDs)
+{
+  const auto      meshCoordinates = mesh.vertexCoordinates();
+  Eigen::MatrixXd coordinates(mesh.getDimensions(), IDs.size());
+  for (const auto &i : IDs | boost::adaptors::indexed()) {
+    coordinates.col(i.index()) = meshCoordinates.col(i.value());
+  }
+  return coordinates;
+}
+
+/**
+ * @brief Estimates the ratio of non-zero entries in the interpolation matrix for basis functions with compact support
+ *
+ * Assumes the vertices to be uniformly distributed in their bounding box, such that the ratio is the share of the
+ * box covered by the support of a single vertex. Axes along which the box is thinner than the support don't reduce the ratio.
+ */
+template <typename IndexContainer>
+double estimateFillRatio(double supportRadius, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs)
+{
+  const int       dimensions = inputMesh.getDimensions();
+  Eigen::VectorXd lower      = Eigen::VectorXd::Constant(dimensions, std::numeric_limits<double>::max());
+  Eigen::VectorXd upper      = Eigen::VectorXd::Constant(dimensions, std::numeric_limits<double>::lowest());
+  for (auto id : inputIDs) {
+    const auto &coords = inputMesh.vertex(id).getCoords();
+    lower              = lower.cwiseMin(coords);
+    upper              = upper.cwiseMax(coords);
+  }
+
+  double ratio       = 1.0;
+  bool   ballCovered = true;
+  for (int d = 0; d < dimensions; ++d) {
+    const double extent = upper(d) - lower(d);
+    if (2 * supportRadius < extent) {
+      ratio *= 2 * supportRadius / extent;
+    } else {
+      ballCovered = false;
+    }
+  }
+  // The support is a ball instead of a box if it fits into the bounding box along all axes
+  if (ballCovered) {
+    ratio *= (dimensions == 2) ? math::PI / 4 : math::PI / 6;
+  }
+  return ratio;
+}
+
+/**
+ * @brief Computes the entries of the lower triangular part of the interpolation matrix for basis functions with compact support
+ *
+ * Only vertices within the support radius are considered, which are found using the spatial index of the input mesh.
+ * Dead axes are not supported, as the index doesn't ignore them in its distance computations.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T, typename IndexContainer>
+std::vector<Eigen::Triplet<double>> buildSparseMatrixCLUEntries(RADIAL_BASIS_FUNCTION_T basisFunction, mesh::Mesh &inputMesh, const IndexContainer &inputIDs)
+{
+  static_assert(RADIAL_BASIS_FUNCTION_T::hasCompactSupport());
+  const double supportRadius = basisFunction.getSupportRadius();
+  const auto   localIndices  = buildLocalIndices(inputIDs);
+
+  const auto neighbors = inputMesh.index().getVerticesInsideBoxBatch(gatherCoordinates(inputMesh, inputIDs), supportRadius);
+
+  std::vector<Eigen::Triplet<double>> entries;
+  for (const auto &i : inputIDs | boost::adaptors::indexed()) {
+    const auto &u = inputMesh.vertex(i.value());
+    for (std::size_t k = neighbors.offsets[i.index()]; k < neighbors.offsets[i.index() + 1]; ++k) {
+      const VertexID     neighbor = neighbors.ids[k];
+      const Eigen::Index j        = findLocalIndex(localIndices, neighbor);
+      if (j >= i.index()) {
+        const double squaredDifference = computeSquaredDifference(u.rawCoords(), inputMesh.vertex(neighbor).rawCoords());
+        entries.emplace_back(j, i.index(), basisFunction.evaluate(std::sqrt(squaredDifference)));
+      }
+    }
+  }
+  return entries;
+}
+
+/// Assembles the evaluation matrix for basis functions with compact support, see buildSparseMatrixCLUEntries()
+template <typename RADIAL_BASIS_FUNCTION_T, typename IndexContainer>
+Eigen::SparseMatrix<double> buildSparseMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                                               const mesh::Mesh &outputMesh, const IndexContainer &outputIDs)
+{
+  static_assert(RADIAL_BASIS_FUNCTION_T::hasCompactSupport());
+  const double supportRadius = basisFunction.getSupportRadius();
+  const auto   localIndices  = buildLocalIndices(inputIDs);
+
+  const auto neighbors = inputMesh.index().getVerticesInsideBoxBatch(gatherCoordinates(outputMesh, outputIDs), supportRadius);
+
+  std::vector<Eigen::Triplet<double>> entries;
+  for (const auto &i : outputIDs | boost::adaptors::indexed()) {
+    const auto &u = outputMesh.vertex(i.value());
+    for (std::size_t k = neighbors.offsets[i.index()]; k < neighbors.offsets[i.index() + 1]; ++k) {
+      const VertexID     neighbor = neighbors.ids[k];
+      const Eigen::Index j        = findLocalIndex(localIndices, neighbor);
+      if (j >= 0) {
+        const double squaredDifference = computeSquaredDifference(u.rawCoords(), inputMesh.vertex(neighbor).rawCoords());
+        entries.emplace_back(i.index(), j, basisFunction.evaluate(std::sqrt(squaredDifference)));
+      }
+    }
+  }
+
+  Eigen::SparseMatrix<double> matrixA(outputIDs.size(), inputIDs.size());
+  matrixA.setFromTriplets(entries.begin(), entries.end());
+  return matrixA;
+}
+
+/// Gathers the coordinates of the given vertices column-wise, where the active axes come first and the remaining rows are set to zero
+template <typename IndexContainer>
+Eigen::Matrix3Xd buildCoordinateMatrix(const mesh::Mesh &mesh, const IndexContainer &IDs, std::array<bool, 3> activeAxis)
+{
+  const Eigen::MatrixXd activeCoordinates = buildActiveCoordinates(mesh, IDs, activeAxis);
+  Eigen::Matrix3Xd      coordinates       = Eigen::Matrix3Xd::Zero(3, IDs.size());
+  coordinates.topRows(activeCoordinates.cols()) = activeCoordinates.transpose();
+  return coordinates;
+}
+
+/// Evaluates blocks of the kernel matrix between the (permuted) vertices of two cluster trees
+template <typename RADIAL_BASIS_FUNCTION_T>
+impl::BlockEvaluator makeKernelEvaluator(const RADIAL_BASIS_FUNCTION_T &basisFunction, const impl::ClusterTree &rowTree, const impl::ClusterTree &colTree)
+{
+  return [&basisFunction, &rowTree, &colTree](Eigen::Index rowBegin, Eigen::Index colBegin, Eigen::MatrixXd &block) {
+    const auto      rowCoordinates = rowTree.coordinates().middleCols(rowBegin, block.rows());
+    const auto &    colCoordinates = colTree.coordinates();
+    const auto      rows           = static_cast<std::size_t>(block.rows());
+    Eigen::VectorXd squaredDistances(rows);
+    for (Eigen::Index j = 0; j < block.cols(); ++j) {
+      squaredDistances = (rowCoordinates.colwise() - colCoordinates.col(colBegin + j)).colwise().squaredNorm().transpose();
+      basisFunction.evaluate({squaredDistances.data(), rows}, {block.col(j).data(), rows});
+    }
+  };
+}
+
 // Variant operating on the Cholesky decopmosition
 inline Eigen::VectorXd computeInverseDiagonal(Eigen::LLT<Eigen::MatrixXd> decMatrixC)
 {
@@ -300,6 +732,13 @@ inline Eigen::VectorXd computeInverseDiagonal(Eigen::ColPivHouseholderQR<Eigen::
   return inverseDiagonal;
 }
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::computesCrossValidation(Polynomial polynomial) const
+{
+  // For polynomial on, the algorithm might fail in determining the size of the system
+  return polynomial != Polynomial::ON && computeCrossValidation && !_sparse && !isMixedPrecision() && !_hierarchical && !_greedy;
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 double RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::evaluateRippaLOOCVerror(const Eigen::VectorXd &lambda) const
 {
@@ -324,22 +763,96 @@ double RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::evaluateRippaLOOCVerror(co
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 template <typename IndexContainer>
-RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
-                                                                    const mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial)
+RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS_FUNCTION_T basisFunction, mesh::Mesh &inputMesh, const IndexContainer &inputIDs,
+                                                                    mesh::Mesh &outputMesh, const IndexContainer &outputIDs, std::vector<bool> deadAxis, Polynomial polynomial,
+                                                                    FactorizationPrecision precision, double compressionTolerance,
+                                                                    bool matrixFree, unsigned int nThreads, double greedyTolerance)
 {
   PRECICE_ASSERT(!(RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite() && polynomial == Polynomial::ON), "The integrated polynomial (polynomial=\"on\") is not supported for the selected radial-basis function. Please select another radial-basis function or change the polynomial configuration.");
   // Convert dead axis vector into an active axis array so that we can handle the reduction more easily
   std::array<bool, 3> activeAxis({{false, false, false}});
   std::transform(deadAxis.begin(), deadAxis.end(), activeAxis.begin(), [](const auto ax) { return !ax; });
 
+  PRECICE_ASSERT(compressionTolerance == 0 || (polynomial != Polynomial::ON && precision == FactorizationPrecision::DOUBLE && !matrixFree),
+                 "Unsupported combination of options for the hierarchical compression");
+  PRECICE_ASSERT(greedyTolerance == 0 || (polynomial != Polynomial::ON && precision == FactorizationPrecision::DOUBLE && compressionTolerance == 0 && !matrixFree),
+                 "Unsupported combination of options for the greedy center selection");
+
+  _greedy = greedyTolerance > 0;
+  PRECICE_CHECK(!_greedy || RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(),
+                "The greedy center selection of the RBF mapping from mesh \"{}\" to mesh \"{}\" requires a strictly positive definite basis function, "
+                "such as gaussian, inverse-multiquadrics or any compactly supported function. Please select another basis function or remove the attribute \"greedy-tolerance\".",
+                inputMesh.getName(), outputMesh.getName());
+
   // First, assemble the interpolation matrix and check the invertability
   bool decompositionSuccessful = false;
-  if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
-    _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).llt();
-    decompositionSuccessful = _decMatrixC.info() == Eigen::ComputationInfo::Success;
-  } else {
-    _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).colPivHouseholderQr();
-    decompositionSuccessful = _decMatrixC.isInvertible();
+  if constexpr (RADIAL_BASIS_FUNCTION_T::hasCompactSupport() && RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
+    // The spatial index cannot ignore dead axes, which are thus only supported by the dense matrices
+    const bool hasDeadAxis = std::any_of(activeAxis.begin(), activeAxis.begin() + inputMesh.getDimensions(), [](bool active) { return !active; });
+    // The estimate avoids assembling the entries of systems, which turn out to be too dense, e.g., small PUM clusters
+    if (!hasDeadAxis && polynomial != Polynomial::ON && !_greedy &&
+        estimateFillRatio(basisFunction.getSupportRadius(), inputMesh, inputIDs) <= maxSparseFillRatio) {
+      const auto entries = buildSparseMatrixCLUEntries(basisFunction, inputMesh, inputIDs);
+      // The entries cover the lower triangular part only
+      const double n        = inputIDs.size();
+      const double nonZeros = 2. * entries.size() - n;
+      _sparse               = nonZeros <= maxSparseFillRatio * n * n;
+      if (_sparse) {
+        PRECICE_DEBUG("Using sparse interpolation matrix with {} non-zero entries", nonZeros);
+        Eigen::SparseMatrix<double> matrixCLU(inputIDs.size(), inputIDs.size());
+        matrixCLU.setFromTriplets(entries.begin(), entries.end());
+        _sparseDecMatrixC       = std::make_unique<Eigen::SimplicialLLT<Eigen::SparseMatrix<double>>>(matrixCLU);
+        decompositionSuccessful = _sparseDecMatrixC->info() == Eigen::ComputationInfo::Success;
+      }
+    }
+  }
+
+  // The cluster tree of the input vertices is shared by both hierarchical matrices
+  std::shared_ptr<const impl::ClusterTree> inputTree;
+  _hierarchical = !_sparse && compressionTolerance > 0;
+
+  // The vertex IDs of the greedily selected centers
+  std::vector<VertexID> centerIDs;
+
+  if (_greedy) {
+    if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
+      const std::vector<VertexID> IDs(inputIDs.begin(), inputIDs.end());
+      for (Eigen::Index center : selectGreedyCenters(basisFunction, buildActiveCoordinates(inputMesh, inputIDs, activeAxis), greedyTolerance)) {
+        centerIDs.push_back(IDs[center]);
+      }
+      PRECICE_DEBUG("Selected {} of {} input vertices as centers", centerIDs.size(), IDs.size());
+      // The least-squares system has full rank, as the kernel matrix of the centers is positive definite
+      _qrMatrixB              = buildMatrixA(basisFunction, inputMesh, centerIDs, inputMesh, inputIDs, activeAxis, polynomial).colPivHouseholderQr();
+      decompositionSuccessful = _qrMatrixB.rank() == static_cast<Eigen::Index>(centerIDs.size());
+    }
+  } else if (_hierarchical) {
+    inputTree               = std::make_shared<const impl::ClusterTree>(buildCoordinateMatrix(inputMesh, inputIDs, activeAxis), hierarchicalLeafSize);
+    _hierarchicalMatrixC    = impl::HODLRMatrix(inputTree, makeKernelEvaluator(basisFunction, *inputTree, *inputTree), compressionTolerance);
+    decompositionSuccessful = _hierarchicalMatrixC.isInvertible();
+    PRECICE_DEBUG("Compressed interpolation matrix to {} entries", _hierarchicalMatrixC.storedEntries());
+  } else if (!_sparse && precision == FactorizationPrecision::MIXED) {
+    // Keep the double-precision matrix to compute the residuals of the iterative refinement
+    _mixedPrecision = true;
+    _matrixC        = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial);
+    if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
+      _decMatrixCLowPrecision = _matrixC.cast<float>().llt();
+      decompositionSuccessful = _decMatrixCLowPrecision.info() == Eigen::ComputationInfo::Success;
+    } else {
+      _decMatrixCLowPrecision = _matrixC.cast<float>().colPivHouseholderQr();
+      decompositionSuccessful = _decMatrixCLowPrecision.isInvertible();
+    }
+    PRECICE_CHECK(decompositionSuccessful,
+                  "The single-precision decomposition of the interpolation matrix of the RBF mapping from mesh \"{}\" to mesh \"{}\" failed. "
+                  "Please disable the mixed-precision option of this mapping.",
+                  inputMesh.getName(), outputMesh.getName());
+  } else if (!_sparse) {
+    if constexpr (RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite()) {
+      _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).llt();
+      decompositionSuccessful = _decMatrixC.info() == Eigen::ComputationInfo::Success;
+    } else {
+      _decMatrixC             = buildMatrixCLU(basisFunction, inputMesh, inputIDs, activeAxis, polynomial).colPivHouseholderQr();
+      decompositionSuccessful = _decMatrixC.isInvertible();
+    }
   }
 
   PRECICE_CHECK(decompositionSuccessful,
@@ -349,14 +862,40 @@ RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctSolver(RADIAL_BASIS
                 "your basis-function (e.g. reduce the support-radius).",
                 inputMesh.getName(), outputMesh.getName());
 
-  // For polynomial on, the algorithm might fail in determining the size of the system
-  if (polynomial != Polynomial::ON && computeCrossValidation) {
+  if (computesCrossValidation(polynomial)) {
     // TODO: Disable synchronization
     precice::profiling::Event e("map.rbf.computeLOOCV");
     _inverseDiagonal = computeInverseDiagonal(_decMatrixC);
   }
+  PRECICE_ASSERT(static_cast<int>(_sparse) + static_cast<int>(_mixedPrecision) + static_cast<int>(_hierarchical) + static_cast<int>(_greedy) <= 1,
+                 _sparse, _mixedPrecision, _hierarchical, _greedy);
+
   // Second, assemble evaluation matrix
-  _matrixA = buildMatrixA(basisFunction, inputMesh, inputIDs, outputMesh, outputIDs, activeAxis, polynomial);
+  if constexpr (RADIAL_BASIS_FUNCTION_T::hasCompactSupport()) {
+    if (_sparse) {
+      _sparseMatrixA = buildSparseMatrixA(basisFunction, inputMesh, inputIDs, outputMesh, outputIDs);
+    }
+  }
+  if (_hierarchical) {
+    const auto outputTree = std::make_shared<const impl::ClusterTree>(buildCoordinateMatrix(outputMesh, outputIDs, activeAxis), hierarchicalLeafSize);
+    _hierarchicalMatrixA  = impl::HierarchicalMatrix(outputTree, inputTree, makeKernelEvaluator(basisFunction, *outputTree, *inputTree), compressionTolerance);
+    PRECICE_DEBUG("Compressed evaluation matrix to {} entries", _hierarchicalMatrixA.storedEntries());
+  } else if (_greedy) {
+    _matrixA = buildMatrixA(basisFunction, inputMesh, centerIDs, outputMesh, outputIDs, activeAxis, polynomial);
+  } else if (!_sparse && matrixFree) {
+    // Keep everything required to evaluate the matrix on the fly
+    _matrixFree        = true;
+    _nThreads          = nThreads;
+    _basisFunction     = std::make_unique<RADIAL_BASIS_FUNCTION_T>(basisFunction);
+    _inputCoordinates  = buildCoordinateMatrix(inputMesh, inputIDs, activeAxis);
+    _outputCoordinates = buildActiveCoordinates(outputMesh, outputIDs, activeAxis);
+    if (polynomial == Polynomial::ON) {
+      _outputPolynomial.resize(outputIDs.size(), 4 - std::count(activeAxis.begin(), activeAxis.end(), false));
+      fillPolynomialEntries(_outputPolynomial, outputMesh, outputIDs, 0, activeAxis);
+    }
+  } else if (!_sparse) {
+    _matrixA = buildMatrixA(basisFunction, inputMesh, inputIDs, outputMesh, outputIDs, activeAxis, polynomial);
+  }
 
   // In case we deal with separated polynomials, we need dedicated matrices for the polynomial contribution
   if (polynomial == Polynomial::SEPARATE) {
@@ -401,12 +940,12 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative
   PRECICE_ASSERT((_matrixV.size() > 0 && polynomial == Polynomial::SEPARATE) || _matrixV.size() == 0, _matrixV.size());
   // TODO: Avoid temporary allocations
   // Au is equal to the eta in our PETSc implementation
-  PRECICE_ASSERT(inputData.size() == _matrixA.rows());
-  Eigen::VectorXd Au = _matrixA.transpose() * inputData;
-  PRECICE_ASSERT(Au.size() == _matrixA.cols());
+  PRECICE_ASSERT(inputData.size() == getOutputSize());
+  Eigen::VectorXd Au = applyTransposedEvaluationMatrix<Eigen::VectorXd>(inputData);
+  PRECICE_ASSERT(Au.size() == getNumberOfCenters());
 
   // mu in the PETSc implementation
-  Eigen::VectorXd out = _decMatrixC.solve(Au);
+  Eigen::VectorXd out = solveTransposedInterpolationSystem<Eigen::VectorXd>(Au);
 
   if (polynomial == Polynomial::SEPARATE) {
     Eigen::VectorXd epsilon = _matrixV.transpose() * inputData;
@@ -434,15 +973,69 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(E
   }
 
   // Integrated polynomial (and separated)
-  PRECICE_ASSERT(inputData.size() == _matrixA.cols());
-  Eigen::VectorXd p = _decMatrixC.solve(inputData);
+  PRECICE_ASSERT(inputData.size() == getInputSize());
+  Eigen::VectorXd p = solveInterpolationSystem<Eigen::VectorXd>(inputData);
 
-  if (polynomial != Polynomial::ON && computeCrossValidation) {
+  if (computesCrossValidation(polynomial)) {
     precice::profiling::Event e("map.rbf.evaluateLOOCV");
     PRECICE_INFO("Cross validation error (LOOCV): {}", evaluateRippaLOOCVerror(p));
   }
-  PRECICE_ASSERT(p.size() == _matrixA.cols());
-  Eigen::VectorXd out = _matrixA * p;
+  PRECICE_ASSERT(p.size() == getNumberOfCenters());
+  Eigen::VectorXd out = applyEvaluationMatrix<Eigen::VectorXd>(p);
+
+  // Add the polynomial part again for separated polynomial
+  if (polynomial == Polynomial::SEPARATE) {
+    out += (_matrixV * polynomialContribution);
+  }
+  return out;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConservative(const Eigen::MatrixXd &inputData, Polynomial polynomial) const
+{
+  PRECICE_ASSERT((_matrixV.size() > 0 && polynomial == Polynomial::SEPARATE) || _matrixV.size() == 0, _matrixV.size());
+  PRECICE_ASSERT(inputData.rows() == getOutputSize());
+  // All right-hand sides are treated in a single matrix-matrix product and a blocked solve
+  Eigen::MatrixXd Au = applyTransposedEvaluationMatrix<Eigen::MatrixXd>(inputData);
+  PRECICE_ASSERT(Au.rows() == getNumberOfCenters());
+
+  Eigen::MatrixXd out = solveTransposedInterpolationSystem<Eigen::MatrixXd>(Au);
+
+  if (polynomial == Polynomial::SEPARATE) {
+    Eigen::MatrixXd epsilon = _matrixV.transpose() * inputData;
+    PRECICE_ASSERT(epsilon.rows() == _matrixV.cols());
+
+    epsilon -= _matrixQ.transpose() * out;
+    PRECICE_ASSERT(epsilon.rows() == _matrixQ.cols());
+
+    out -= static_cast<Eigen::MatrixXd>(_qrMatrixQ.transpose().solve(-epsilon));
+  }
+  return out;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(Eigen::MatrixXd &inputData, Polynomial polynomial) const
+{
+  PRECICE_ASSERT((_matrixQ.size() > 0 && polynomial == Polynomial::SEPARATE) || _matrixQ.size() == 0);
+  Eigen::MatrixXd polynomialContribution;
+  // Solve polynomial QR and subtract it from the input data
+  if (polynomial == Polynomial::SEPARATE) {
+    polynomialContribution = _qrMatrixQ.solve(inputData);
+    inputData -= (_matrixQ * polynomialContribution);
+  }
+
+  // All right-hand sides are treated in a single blocked solve and a matrix-matrix product
+  PRECICE_ASSERT(inputData.rows() == getInputSize());
+  Eigen::MatrixXd p = solveInterpolationSystem<Eigen::MatrixXd>(inputData);
+
+  if (computesCrossValidation(polynomial)) {
+    precice::profiling::Event e("map.rbf.evaluateLOOCV");
+    for (Eigen::Index c = 0; c < p.cols(); ++c) {
+      PRECICE_INFO("Cross validation error (LOOCV): {}", evaluateRippaLOOCVerror(p.col(c)));
+    }
+  }
+  PRECICE_ASSERT(p.rows() == getNumberOfCenters());
+  Eigen::MatrixXd out = applyEvaluationMatrix<Eigen::MatrixXd>(p);
 
   // Add the polynomial part again for separated polynomial
   if (polynomial == Polynomial::SEPARATE) {
@@ -454,20 +1047,278 @@ Eigen::VectorXd RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveConsistent(E
 template <typename RADIAL_BASIS_FUNCTION_T>
 void RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::clear()
 {
-  _matrixA    = Eigen::MatrixXd();
-  _decMatrixC = DecompositionType();
+  _matrixA          = Eigen::MatrixXd();
+  _decMatrixC       = DecompositionType();
+  _sparseMatrixA    = Eigen::SparseMatrix<double>();
+  _sparseDecMatrixC.reset();
+  _sparse           = false;
+
+  _decMatrixCLowPrecision = LowPrecisionDecompositionType();
+  _mixedPrecision         = false;
+  _matrixC                = Eigen::MatrixXd();
+  _basisFunction.reset();
+  _inputCoordinates = Eigen::Matrix3Xd();
+
+  _outputCoordinates = Eigen::MatrixXd();
+  _outputPolynomial  = Eigen::MatrixXd();
+  _matrixFree        = false;
+
+  _qrMatrixB = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _greedy    = false;
+
+  _hierarchicalMatrixC = impl::HODLRMatrix();
+  _hierarchicalMatrixA = impl::HierarchicalMatrix();
+  _hierarchical        = false;
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 Eigen::Index RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getInputSize() const
 {
+  if (_sparse) {
+    return _sparseMatrixA.cols();
+  }
+  if (_hierarchical) {
+    return _hierarchicalMatrixA.cols();
+  }
+  if (_matrixFree) {
+    return _inputCoordinates.cols() + _outputPolynomial.cols();
+  }
+  if (_greedy) {
+    return _qrMatrixB.rows();
+  }
   return _matrixA.cols();
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
 Eigen::Index RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getOutputSize() const
 {
+  if (_sparse) {
+    return _sparseMatrixA.rows();
+  }
+  if (_hierarchical) {
+    return _hierarchicalMatrixA.rows();
+  }
+  if (_matrixFree) {
+    return _outputCoordinates.rows();
+  }
   return _matrixA.rows();
 }
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::isSparse() const
+{
+  return _sparse;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::isMixedPrecision() const
+{
+  return _mixedPrecision;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::isHierarchical() const
+{
+  return _hierarchical;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::isMatrixFree() const
+{
+  return _matrixFree;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::Index RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::getNumberOfCenters() const
+{
+  return _greedy ? _qrMatrixB.cols() : getInputSize();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename MatrixType>
+MatrixType RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveInterpolationSystem(const MatrixType &rhs) const
+{
+  if (_sparse) {
+    return _sparseDecMatrixC->solve(rhs);
+  }
+  if (_greedy) {
+    return _qrMatrixB.solve(rhs);
+  }
+  if (_hierarchical) {
+    return _hierarchicalMatrixC.solve(rhs);
+  }
+  if (isMixedPrecision()) {
+    return solveMixedPrecision(rhs);
+  }
+  return _decMatrixC.solve(rhs);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename MatrixType>
+MatrixType RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveTransposedInterpolationSystem(const MatrixType &rhs) const
+{
+  if (!_greedy) {
+    // All other interpolation matrices are symmetric
+    return solveInterpolationSystem(rhs);
+  }
+  // With the decomposition B P = Q R, the least-squares solution operator is P R^-1 Q^T and its transpose Q R^-T P^T
+  const Eigen::Index centers = _qrMatrixB.cols();
+  MatrixType         z       = _qrMatrixB.colsPermutation().transpose() * rhs;
+  _qrMatrixB.matrixR().topLeftCorner(centers, centers).template triangularView<Eigen::Upper>().transpose().solveInPlace(z);
+
+  MatrixType result = MatrixType::Zero(_qrMatrixB.rows(), rhs.cols());
+  result.topRows(centers) = z;
+  return _qrMatrixB.householderQ() * result;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename MatrixType>
+MatrixType RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::solveMixedPrecision(const MatrixType &rhs) const
+{
+  using LowPrecisionType = Eigen::Matrix<float, MatrixType::RowsAtCompileTime, MatrixType::ColsAtCompileTime>;
+
+  MatrixType   solution = _decMatrixCLowPrecision.solve(LowPrecisionType(rhs.template cast<float>())).template cast<double>();
+  const double rhsNorm  = rhs.norm();
+
+  // Iterative refinement: correct the solution by solving for the residual, which is computed in double precision
+  double residualNorm = std::numeric_limits<double>::max();
+  for (int step = 0;; ++step) {
+    const MatrixType residual         = rhs - _matrixC * solution;
+    const double     lastResidualNorm = residualNorm;
+    residualNorm                      = residual.norm();
+    PRECICE_DEBUG("Refinement step {}: relative residual {}", step, residualNorm / rhsNorm);
+    // Stop on convergence or if the refinement stagnates
+    if (residualNorm <= refinementTolerance * rhsNorm || step == maxRefinementSteps || residualNorm > 0.5 * lastResidualNorm) {
+      break;
+    }
+    solution += _decMatrixCLowPrecision.solve(LowPrecisionType(residual.template cast<float>())).template cast<double>();
+  }
+
+  PRECICE_WARN_IF(residualNorm > maxRefinementResidual * rhsNorm,
+                  "The iterative refinement of the mixed-precision RBF solver stagnated at a relative residual of {}. "
+                  "The interpolation matrix is likely too ill-conditioned for a single-precision decomposition. "
+                  "Please disable the mixed-precision option of this mapping.",
+                  residualNorm / rhsNorm);
+  return solution;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename MatrixType>
+MatrixType RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::applyEvaluationMatrix(const MatrixType &coefficients) const
+{
+  if (_sparse) {
+    return _sparseMatrixA * coefficients;
+  }
+  if (_hierarchical) {
+    return _hierarchicalMatrixA.apply(coefficients);
+  }
+  if (_matrixFree) {
+    return applyMatrixFreeEvaluationMatrix(coefficients);
+  }
+  return _matrixA * coefficients;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename MatrixType>
+MatrixType RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::applyTransposedEvaluationMatrix(const MatrixType &data) const
+{
+  if (_sparse) {
+    return _sparseMatrixA.transpose() * data;
+  }
+  if (_hierarchical) {
+    return _hierarchicalMatrixA.applyTransposed(data);
+  }
+  if (_matrixFree) {
+    return applyMatrixFreeTransposedEvaluationMatrix(data);
+  }
+  return _matrixA.transpose() * data;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::evaluateTile(Eigen::Index rowBegin, Eigen::Index colBegin, Eigen::Index rows, Eigen::Index cols,
+                                                                 Eigen::MatrixXd &tile, Eigen::VectorXd &squaredDistances) const
+{
+  PRECICE_ASSERT(_basisFunction);
+  PRECICE_ASSERT(tile.rows() >= rows && tile.cols() >= cols && squaredDistances.size() >= rows);
+  const auto size = static_cast<std::size_t>(rows);
+  visitActiveDimensions(_outputCoordinates.cols(), [&](auto dimensions) {
+    constexpr int dim = decltype(dimensions)::value;
+    // Each column of output vertices is evaluated as one batch, the active axes of the input coordinates come first
+    for (Eigen::Index j = 0; j < cols; ++j) {
+      computeSquaredDistances<dim>(_outputCoordinates, rowBegin, rows, _inputCoordinates.col(colBegin + j).template head<dim>(), squaredDistances.data());
+      _basisFunction->evaluate({squaredDistances.data(), size}, {tile.col(j).data(), size});
+    }
+  });
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename MatrixType>
+MatrixType RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::applyMatrixFreeEvaluationMatrix(const MatrixType &coefficients) const
+{
+  const Eigen::Index outputSize = _outputCoordinates.rows();
+  const Eigen::Index inputSize  = _inputCoordinates.cols();
+  const Eigen::Index polyParams = _outputPolynomial.cols();
+  PRECICE_ASSERT(coefficients.rows() == inputSize + polyParams, coefficients.rows(), inputSize, polyParams);
+
+  MatrixType result(outputSize, coefficients.cols());
+
+  // Every thread computes the result for its tiles of output vertices, such that the threads write to distinct rows
+  const std::size_t nTiles = (outputSize + evaluationTileRows - 1) / evaluationTileRows;
+  utils::parallelForChunks(nTiles, utils::chunkCount(nTiles, 1, _nThreads), [&](std::size_t, std::size_t tileBegin, std::size_t tileEnd) {
+    Eigen::MatrixXd tile(evaluationTileRows, evaluationTileCols);
+    Eigen::VectorXd squaredDistances(evaluationTileRows);
+    for (std::size_t t = tileBegin; t < tileEnd; ++t) {
+      const Eigen::Index rowBegin = t * evaluationTileRows;
+      const Eigen::Index rows     = std::min(evaluationTileRows, outputSize - rowBegin);
+      auto               out      = result.middleRows(rowBegin, rows);
+      if (polyParams > 0) {
+        out.noalias() = _outputPolynomial.middleRows(rowBegin, rows) * coefficients.bottomRows(polyParams);
+      } else {
+        out.setZero();
+      }
+      for (Eigen::Index colBegin = 0; colBegin < inputSize; colBegin += evaluationTileCols) {
+        const Eigen::Index cols = std::min(evaluationTileCols, inputSize - colBegin);
+        evaluateTile(rowBegin, colBegin, rows, cols, tile, squaredDistances);
+        out.noalias() += tile.topLeftCorner(rows, cols) * coefficients.middleRows(colBegin, cols);
+      }
+    }
+  });
+  return result;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename MatrixType>
+MatrixType RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>::applyMatrixFreeTransposedEvaluationMatrix(const MatrixType &data) const
+{
+  const Eigen::Index outputSize = _outputCoordinates.rows();
+  const Eigen::Index inputSize  = _inputCoordinates.cols();
+  const Eigen::Index polyParams = _outputPolynomial.cols();
+  PRECICE_ASSERT(data.rows() == outputSize, data.rows(), outputSize);
+
+  MatrixType result(inputSize + polyParams, data.cols());
+
+  // Every thread computes the result for its tiles of input vertices, which avoids a reduction across threads
+  const std::size_t nTiles = (inputSize + evaluationTileCols - 1) / evaluationTileCols;
+  utils::parallelForChunks(nTiles, utils::chunkCount(nTiles, 1, _nThreads), [&](std::size_t, std::size_t tileBegin, std::size_t tileEnd) {
+    Eigen::MatrixXd tile(evaluationTileRows, evaluationTileCols);
+    Eigen::VectorXd squaredDistances(evaluationTileRows);
+    for (std::size_t t = tileBegin; t < tileEnd; ++t) {
+      const Eigen::Index colBegin = t * evaluationTileCols;
+      const Eigen::Index cols     = std::min(evaluationTileCols, inputSize - colBegin);
+      auto               out      = result.middleRows(colBegin, cols);
+      out.setZero();
+      for (Eigen::Index rowBegin = 0; rowBegin < outputSize; rowBegin += evaluationTileRows) {
+        const Eigen::Index rows = std::min(evaluationTileRows, outputSize - rowBegin);
+        evaluateTile(rowBegin, colBegin, rows, cols, tile, squaredDistances);
+        out.noalias() += tile.topLeftCorner(rows, cols).transpose() * data.middleRows(rowBegin, rows);
+      }
+    }
+  });
+
+  if (polyParams > 0) {
+    result.bottomRows(polyParams).noalias() = _outputPolynomial.transpose() * data;
+  }
+  return result;
+}
 } // namespace mapping
 } // namespace precice
@@ -2,6 +2,7 @@
 #include <Eigen/Core>
 #include <algorithm>
 #include <cstring>
+#include <fmt/format.h>
 #include <list>
 #include <memory>
 #include <ostream>
@@ -75,7 +76,7 @@ struct BackendSelector {
 // Specialization for the RBF Eigen backend
 template <typename RBF>
 struct BackendSelector<RBFBackend::Eigen, RBF> {
-  typedef mapping::RadialBasisFctMapping<RadialBasisFctSolver<RBF>> type;
+  typedef mapping::RadialBasisFctMapping<RadialBasisFctSolver<RBF>, FactorizationPrecision, double, bool, unsigned int, double> type;
 };
 
 // Specialization for the PETSc RBF backend
@@ -221,6 +222,28 @@ MappingConfiguration::MappingConfiguration(
                                .setDocumentation("Toggles use a local (per cluster) polynomial")
                                .setOptions({POLYNOMIAL_OFF, POLYNOMIAL_SEPARATE});
 
+  auto attrMixedPrecision = makeXMLAttribute(ATTR_MIXED_PRECISION, false)
+                                .setDocumentation("If set to true, the interpolation system is factorized in single precision and the solution is recovered to double precision using iterative refinement. "
+                                                  "This speeds up the factorization, but requires additional memory for the single-precision copy of the system and may fail for ill-conditioned systems. Only applies to the cpu-executor. "
+                                                  "Sufficiently sparse systems of compactly supported basis functions are factorized as sparse systems in double precision instead.");
+
+  auto attrCompressionTolerance = makeXMLAttribute(ATTR_COMPRESSION_TOLERANCE, 0.)
+                                      .setDocumentation("If positive, the dense system matrices are compressed to hierarchical matrices with the given relative accuracy, "
+                                                        "which reduces their memory footprint from quadratic to almost linear in the number of vertices. "
+                                                        "Suited for global basis functions, such as thin-plate-splines or multiquadrics. Sufficiently sparse systems of compactly supported basis functions are factorized as sparse systems instead. "
+                                                        "Requires polynomial=\"separate\" or polynomial=\"off\". A value of 0 disables the compression. Only applies to the cpu-executor.");
+
+  auto attrMatrixFree = makeXMLAttribute(ATTR_MATRIX_FREE_EVALUATION, false)
+                            .setDocumentation("If set to true, the evaluation matrix is not stored, but recomputed in cache-sized blocks whenever data is mapped. "
+                                              "This saves memory proportional to the product of the input and output mesh sizes at the cost of additional basis function evaluations per mapping. Only applies to the cpu-executor.");
+  auto attrGreedyTolerance = makeXMLAttribute(ATTR_GREEDY_TOLERANCE, 0.)
+                                 .setDocumentation("If positive, only a subset of the input vertices is used as RBF centers, which is selected greedily until the power function of the centers, "
+                                                   "relative to its maximum, is below the given tolerance. The remaining input vertices are fitted in a least-squares sense. "
+                                                   "This reduces the cost of the mapping for large and oversampled input meshes. Requires a strictly positive definite basis function and "
+                                                   "polynomial=\"separate\" or polynomial=\"off\". A value of 0 uses all input vertices. Only applies to the cpu-executor.");
+  auto directThreads = makeXMLAttribute(ATTR_N_THREADS, 1)
+                           .setDocumentation("Number of threads used for the matrix-free evaluation (matrix-free-evaluation=\"true\"). A value of \"0\" uses all available hardware threads.");
+
   auto attrSolverRtol = makeXMLAttribute(ATTR_SOLVER_RTOL, 1e-9)
                             .setDocumentation("Solver relative tolerance for convergence");
   // TODO: Discuss whether we wanto to introduce this attribute
@@ -233,6 +256,20 @@ MappingConfiguration::MappingConfiguration(
                              .setDocumentation("Value between 0 and 1 indicating the relative overlap between clusters. A value of 0.15 is usually a good trade-off between accuracy and efficiency.");
   auto projectToInput = XMLAttribute<bool>(ATTR_PROJECT_TO_INPUT, true)
                             .setDocumentation("If enabled, places the cluster centers at the closest vertex of the input mesh. Should be enabled in case of non-uniform point distributions such as for shell structures.");
+  auto balanceClusters = XMLAttribute<bool>(ATTR_BALANCE_CLUSTERS, false)
+                             .setDocumentation("If enabled, splits clusters with many more vertices than vertices-per-cluster and grows clusters with much fewer vertices, "
+                                               "which balances the cost of the clusters for non-uniform point distributions.");
+  auto pumThreads = makeXMLAttribute(ATTR_N_THREADS, 1)
+                        .setDocumentation("Number of threads used to compute the clusters and to evaluate the mapping in the rbf partition of unity method. A value of \"0\" uses all available hardware threads.");
+
+  auto projectionThreads = makeXMLAttribute(ATTR_N_THREADS, 1)
+                               .setDocumentation("Number of threads used to compute the mapping. A value of \"0\" uses all available hardware threads.");
+
+  auto attrCacheDirectory = makeXMLAttribute(ATTR_CACHE_DIRECTORY, "")
+                                .setDocumentation("Directory to store computed mappings in and to load them from in subsequent runs with identical meshes and partitioning. "
+                                                  "Stored mappings are identified by the mapping, both meshes and the partitioning. An empty value disables the cache. "
+                                                  "The cache is only available for the nearest-neighbor, nearest-projection and linear-cell-interpolation mappings. "
+                                                  "Radial-basis-function mappings, including the partition of unity, are not cached and always compute their systems, which is usually the most expensive part of the mapping setup.");
 
   auto attrGeoMultiscaleType = XMLAttribute<std::string>(ATTR_GEOMETRIC_MULTISCALE_TYPE)
                                    .setDocumentation("Type of geometric multiscale mapping. Either 'spread' or 'collect'.")
@@ -244,10 +281,10 @@ MappingConfiguration::MappingConfiguration(
                                      .setDocumentation("Radius of the circular interface between the 1D and 3D participant.");
 
   // Add the relevant attributes to the relevant tags
-  addAttributes(projectionTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint});
-  addAttributes(rbfDirectTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPolynomial, attrXDead, attrYDead, attrZDead});
+  addAttributes(projectionTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, projectionThreads, attrCacheDirectory});
+  addAttributes(rbfDirectTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPolynomial, attrXDead, attrYDead, attrZDead, attrMixedPrecision, attrCompressionTolerance, attrMatrixFree, attrGreedyTolerance, directThreads});
   addAttributes(rbfIterativeTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPolynomial, attrXDead, attrYDead, attrZDead, attrSolverRtol});
-  addAttributes(pumDirectTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPumPolynomial, verticesPerCluster, relativeOverlap, projectToInput});
+  addAttributes(pumDirectTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrPumPolynomial, verticesPerCluster, relativeOverlap, projectToInput, balanceClusters, attrGreedyTolerance, pumThreads});
   addAttributes(rbfAliasTag, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrXDead, attrYDead, attrZDead});
   addAttributes(geoMultiscaleTags, {attrFromMesh, attrToMesh, attrDirection, attrConstraint, attrGeoMultiscaleType, attrGeoMultiscaleAxis, attrGeoMultiscaleRadius});
 
@@ -379,11 +416,15 @@ void MappingConfiguration::xmlTagCallback(
     // optional tags
     // We set here default values, but their actual value doesn't really matter.
     // It's just for the mapping methods, which do not use these attributes at all.
-    bool        xDead         = tag.getBooleanAttributeValue(ATTR_X_DEAD, false);
-    bool        yDead         = tag.getBooleanAttributeValue(ATTR_Y_DEAD, false);
-    bool        zDead         = tag.getBooleanAttributeValue(ATTR_Z_DEAD, false);
-    double      solverRtol    = tag.getDoubleAttributeValue(ATTR_SOLVER_RTOL, 1e-9);
-    std::string strPolynomial = tag.getStringAttributeValue(ATTR_POLYNOMIAL, POLYNOMIAL_SEPARATE);
+    bool        xDead                = tag.getBooleanAttributeValue(ATTR_X_DEAD, false);
+    bool        yDead                = tag.getBooleanAttributeValue(ATTR_Y_DEAD, false);
+    bool        zDead                = tag.getBooleanAttributeValue(ATTR_Z_DEAD, false);
+    double      solverRtol           = tag.getDoubleAttributeValue(ATTR_SOLVER_RTOL, 1e-9);
+    std::string strPolynomial        = tag.getStringAttributeValue(ATTR_POLYNOMIAL, POLYNOMIAL_SEPARATE);
+    bool        mixedPrecision       = tag.getBooleanAttributeValue(ATTR_MIXED_PRECISION, false);
+    double      compressionTolerance = tag.getDoubleAttributeValue(ATTR_COMPRESSION_TOLERANCE, 0.);
+    bool        matrixFree           = tag.getBooleanAttributeValue(ATTR_MATRIX_FREE_EVALUATION, false);
+    double      greedyTolerance      = tag.getDoubleAttributeValue(ATTR_GREEDY_TOLERANCE, 0.);
 
     // geometric multiscale related tags
     std::string geoMultiscaleType = tag.getStringAttributeValue(ATTR_GEOMETRIC_MULTISCALE_TYPE, "");
@@ -406,6 +447,11 @@ void MappingConfiguration::xmlTagCallback(
     int    verticesPerCluster = tag.getIntAttributeValue(ATTR_VERTICES_PER_CLUSTER, 100);
     double relativeOverlap    = tag.getDoubleAttributeValue(ATTR_RELATIVE_OVERLAP, 0.3);
     bool   projectToInput     = tag.getBooleanAttributeValue(ATTR_PROJECT_TO_INPUT, true);
+    bool   balanceClusters    = tag.getBooleanAttributeValue(ATTR_BALANCE_CLUSTERS, false);
+    int    nThreads           = tag.getIntAttributeValue(ATTR_N_THREADS, 1);
+
+    // operator cache, only available for projection-based mappings
+    std::string cacheDirectory = tag.getStringAttributeValue(ATTR_CACHE_DIRECTORY, "");
 
     // Convert raw string into enum types as the constructors take enums
     if (constraint == CONSTRAINT_CONSERVATIVE) {
@@ -421,8 +467,17 @@ void MappingConfiguration::xmlTagCallback(
     }
 
     ConfiguredMapping configuredMapping = createMapping(dir, type, fromMesh, toMesh, geoMultiscaleType, geoMultiscaleAxis, multiscaleRadius);
+    if (!cacheDirectory.empty()) {
+      PRECICE_ASSERT(configuredMapping.mapping);
+      configuredMapping.mapping->setCacheDirectory(cacheDirectory);
+    }
+    // RBF mappings are instantiated later on and receive their threads through their constructor
+    if (configuredMapping.mapping) {
+      PRECICE_CHECK(nThreads >= 0, "The number of threads of the mapping from mesh \"{}\" to mesh \"{}\" has to be non-negative, but is {}.", fromMesh, toMesh, nThreads);
+      configuredMapping.mapping->setNumberOfThreads(nThreads);
+    }
 
-    _rbfConfig = configureRBFMapping(type, strPolynomial, xDead, yDead, zDead, solverRtol, verticesPerCluster, relativeOverlap, projectToInput);
+    _rbfConfig = configureRBFMapping(type, strPolynomial, xDead, yDead, zDead, solverRtol, verticesPerCluster, relativeOverlap, projectToInput, balanceClusters, nThreads, mixedPrecision, compressionTolerance, matrixFree, greedyTolerance);
 
     checkDuplicates(configuredMapping);
     _mappings.push_back(configuredMapping);
@@ -481,7 +536,13 @@ MappingConfiguration::RBFConfiguration MappingConfiguration::configureRBFMapping
                                                                                  double solverRtol,
                                                                                  double verticesPerCluster,
                                                                                  double relativeOverlap,
-                                                                                 bool   projectToInput) const
+                                                                                 bool   projectToInput,
+                                                                                 bool   balanceClusters,
+                                                                                 int    nThreads,
+                                                                                 bool   mixedPrecision,
+                                                                                 double compressionTolerance,
+                                                                                 bool   matrixFree,
+                                                                                 double greedyTolerance) const
 {
   RBFConfiguration rbfConfig;
 
@@ -515,6 +576,30 @@ MappingConfiguration::RBFConfiguration MappingConfiguration::configureRBFMapping
   rbfConfig.verticesPerCluster = verticesPerCluster;
   rbfConfig.relativeOverlap    = relativeOverlap;
   rbfConfig.projectToInput     = projectToInput;
+  rbfConfig.balanceClusters    = balanceClusters;
+
+  PRECICE_CHECK(nThreads >= 0, "The number of threads of the rbf mapping has to be non-negative, but is {}.", nThreads);
+  rbfConfig.nThreads = nThreads;
+
+  rbfConfig.precision = mixedPrecision ? FactorizationPrecision::MIXED : FactorizationPrecision::DOUBLE;
+
+  PRECICE_CHECK(compressionTolerance >= 0, "The compression-tolerance of the rbf-global-direct mapping has to be non-negative, but is {}.", compressionTolerance);
+  PRECICE_CHECK(compressionTolerance == 0 || rbfConfig.polynomial != Polynomial::ON,
+                "The hierarchical compression (compression-tolerance) doesn't support the integrated polynomial. Please configure polynomial=\"separate\" or polynomial=\"off\".");
+  PRECICE_CHECK(compressionTolerance == 0 || !mixedPrecision,
+                "The hierarchical compression (compression-tolerance) cannot be combined with the mixed-precision factorization. Please disable one of both options.");
+  rbfConfig.compressionTolerance = compressionTolerance;
+
+  PRECICE_CHECK(!matrixFree || compressionTolerance == 0,
+                "The matrix-free evaluation (matrix-free-evaluation) cannot be combined with the hierarchical compression (compression-tolerance), which stores a compressed evaluation matrix instead. Please disable one of both options.");
+  rbfConfig.matrixFree = matrixFree;
+
+  PRECICE_CHECK(greedyTolerance >= 0 && greedyTolerance < 1, "The greedy-tolerance of the rbf mapping has to be in [0, 1), but is {}.", greedyTolerance);
+  PRECICE_CHECK(greedyTolerance == 0 || rbfConfig.polynomial != Polynomial::ON,
+                "The greedy center selection (greedy-tolerance) doesn't support the integrated polynomial. Please configure polynomial=\"separate\" or polynomial=\"off\".");
+  PRECICE_CHECK(greedyTolerance == 0 || (compressionTolerance == 0 && !mixedPrecision && !matrixFree),
+                "The greedy center selection (greedy-tolerance) cannot be combined with the hierarchical compression, the mixed-precision factorization or the matrix-free evaluation. Please disable one of these options.");
+  rbfConfig.greedyTolerance = greedyTolerance;
 
   return rbfConfig;
 }
@@ -685,7 +770,17 @@ void MappingConfiguration::finishRBFConfiguration()
   // 1. the CPU executor
   if (_executorConfig->executor == ExecutorConfiguration::Executor::CPU) {
     if (_rbfConfig.solver == RBFConfiguration::SystemSolver::GlobalDirect) {
-      mapping.mapping = getRBFMapping<RBFBackend::Eigen>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.deadAxis, _rbfConfig.polynomial);
+      const bool compactSupport = std::visit([](const auto &function) { return function.hasCompactSupport(); },
+                                             constructRBF(_rbfConfig.basisFunction, _rbfConfig.supportRadius, _rbfConfig.shapeParameter));
+      PRECICE_WARN_IF(_rbfConfig.precision == FactorizationPrecision::MIXED && compactSupport,
+                      "The mixed-precision factorization of the mapping from mesh \"{}\" to mesh \"{}\" is ignored if the interpolation matrix of the compactly supported basis function turns out to be sparse. "
+                      "Such systems are factorized as sparse systems in double precision. Please remove the attribute \"mixed-precision\" or select a basis function with global support to avoid this.",
+                      mapping.fromMesh->getName(), mapping.toMesh->getName());
+      PRECICE_WARN_IF(_rbfConfig.compressionTolerance > 0 && compactSupport,
+                      "The hierarchical compression of the mapping from mesh \"{}\" to mesh \"{}\" is ignored if the interpolation matrix of the compactly supported basis function turns out to be sparse. "
+                      "Such systems are factorized as sparse systems in double precision. Please remove the attribute \"compression-tolerance\" or select a basis function with global support to avoid this.",
+                      mapping.fromMesh->getName(), mapping.toMesh->getName());
+      mapping.mapping = getRBFMapping<RBFBackend::Eigen>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.deadAxis, _rbfConfig.polynomial, _rbfConfig.precision, _rbfConfig.compressionTolerance, _rbfConfig.matrixFree, _rbfConfig.nThreads, _rbfConfig.greedyTolerance);
     } else if (_rbfConfig.solver == RBFConfiguration::SystemSolver::GlobalIterative) {
 #ifndef PRECICE_NO_PETSC
       // for petsc initialization
@@ -696,12 +791,28 @@ void MappingConfiguration::finishRBFConfiguration()
       PRECICE_CHECK(false, "The global-iterative RBF solver on a CPU requires a preCICE build with PETSc enabled.");
 #endif
     } else if (_rbfConfig.solver == RBFConfiguration::SystemSolver::PUMDirect) {
-      mapping.mapping = getRBFMapping<RBFBackend::PUM>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.polynomial, _rbfConfig.verticesPerCluster, _rbfConfig.relativeOverlap, _rbfConfig.projectToInput);
+      mapping.mapping = getRBFMapping<RBFBackend::PUM>(_rbfConfig.basisFunction, constraintValue, mapping.fromMesh->getDimensions(), _rbfConfig.supportRadius, _rbfConfig.shapeParameter, _rbfConfig.polynomial, _rbfConfig.verticesPerCluster, _rbfConfig.relativeOverlap, _rbfConfig.projectToInput, _rbfConfig.nThreads, _rbfConfig.greedyTolerance, _rbfConfig.balanceClusters);
     } else {
       PRECICE_UNREACHABLE("Unknown RBF solver.");
     }
     // 2. any other executor is configured via Ginkgo
   } else {
+    PRECICE_CHECK(_rbfConfig.precision == FactorizationPrecision::DOUBLE,
+                  "The mixed-precision factorization (configured for the mapping from mesh {} to mesh {}) is only available for the cpu-executor. "
+                  "Please remove the attribute \"mixed-precision\" or use the cpu-executor.",
+                  mapping.fromMesh->getName(), mapping.toMesh->getName());
+    PRECICE_CHECK(_rbfConfig.compressionTolerance == 0,
+                  "The hierarchical compression (configured for the mapping from mesh {} to mesh {}) is only available for the cpu-executor. "
+                  "Please remove the attribute \"compression-tolerance\" or use the cpu-executor.",
+                  mapping.fromMesh->getName(), mapping.toMesh->getName());
+    PRECICE_CHECK(!_rbfConfig.matrixFree,
+                  "The matrix-free evaluation (configured for the mapping from mesh {} to mesh {}) is only available for the cpu-executor. "
+                  "Please remove the attribute \"matrix-free-evaluation\" or use the cpu-executor.",
+                  mapping.fromMesh->getName(), mapping.toMesh->getName());
+    PRECICE_CHECK(_rbfConfig.greedyTolerance == 0,
+                  "The greedy center selection (configured for the mapping from mesh {} to mesh {}) is only available for the cpu-executor. "
+                  "Please remove the attribute \"greedy-tolerance\" or use the cpu-executor.",
+                  mapping.fromMesh->getName(), mapping.toMesh->getName());
 #ifndef PRECICE_NO_GINKGO
     _ginkgoParameter                   = GinkgoParameter();
     _ginkgoParameter.usePreconditioner = false;
@@ -737,6 +848,36 @@ void MappingConfiguration::finishRBFConfiguration()
     PRECICE_CHECK(false, "The selected executor for the mapping from mesh {} to mesh {} requires a preCICE build with Ginkgo enabled.", mapping.fromMesh->getName(), mapping.toMesh->getName());
 #endif
   }
+
+  // The PETSc mapping assembles its system differently and doesn't support sharing
+  if (_executorConfig->executor != ExecutorConfiguration::Executor::CPU || _rbfConfig.solver != RBFConfiguration::SystemSolver::GlobalIterative) {
+    shareEquivalentOperator();
+  }
+}
+
+void MappingConfiguration::shareEquivalentOperator()
+{
+  const ConfiguredMapping &mapping = _mappings.back();
+
+  // The interpolation system is always solved on the input mesh of a consistent and the output mesh of a conservative mapping
+  const bool         conservative = constraintValue == Mapping::CONSERVATIVE;
+  const std::string &systemMesh   = conservative ? mapping.toMesh->getName() : mapping.fromMesh->getName();
+  const std::string &otherMesh    = conservative ? mapping.fromMesh->getName() : mapping.toMesh->getName();
+
+  const auto &c   = _rbfConfig;
+  std::string key = fmt::format("{}|{}|{}|{}|{}|{}|{}{}{}|{}|{}|{}|{}|{}|{}|{}|{}|{}|{}|{}|{}|{}|{}",
+                                systemMesh, otherMesh, static_cast<int>(c.solver), static_cast<int>(c.basisFunction), c.supportRadius, c.shapeParameter,
+                                c.deadAxis[0], c.deadAxis[1], c.deadAxis[2], static_cast<int>(c.polynomial), c.solverRtol, c.verticesPerCluster,
+                                c.relativeOverlap, c.projectToInput, c.balanceClusters, c.nThreads, static_cast<int>(c.precision), c.compressionTolerance, c.matrixFree,
+                                c.greedyTolerance, static_cast<int>(_executorConfig->executor), _executorConfig->deviceId, _executorConfig->nThreads);
+
+  auto [iter, inserted] = _equivalentMappings.emplace(key, mapping.mapping);
+  if (inserted) {
+    return;
+  }
+  PRECICE_DEBUG("The mapping from mesh \"{}\" to mesh \"{}\" shares its operator with an equivalent mapping.", mapping.fromMesh->getName(), mapping.toMesh->getName());
+  iter->second->setOperatorRegistry(_operatorRegistry, key);
+  mapping.mapping->setOperatorRegistry(_operatorRegistry, key);
 }
 
 const std::vector<MappingConfiguration::ConfiguredMapping> &MappingConfiguration::mappings()
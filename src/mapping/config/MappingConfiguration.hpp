@@ -1,11 +1,14 @@
 #pragma once
 
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
 #include "mapping/SharedPointer.hpp"
 #include "mapping/config/MappingConfigurationTypes.hpp"
+#include "mapping/OperatorRegistry.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "xml/XMLTag.hpp"
 
@@ -85,17 +88,23 @@ public:
       GlobalIterative,
       PUMDirect
     };
-    SystemSolver        solver{};
-    std::array<bool, 3> deadAxis{};
-    Polynomial          polynomial{};
-    double              solverRtol{};
-    int                 verticesPerCluster{};
-    double              relativeOverlap{};
-    bool                projectToInput{};
-    BasisFunction       basisFunction{};
-    double              supportRadius{};
-    double              shapeParameter{};
-    bool                basisFunctionDefined = false;
+    SystemSolver           solver{};
+    std::array<bool, 3>    deadAxis{};
+    Polynomial             polynomial{};
+    double                 solverRtol{};
+    int                    verticesPerCluster{};
+    double                 relativeOverlap{};
+    bool                   projectToInput{};
+    bool                   balanceClusters{};
+    unsigned int           nThreads{};
+    BasisFunction          basisFunction{};
+    double                 supportRadius{};
+    double                 shapeParameter{};
+    bool                   basisFunctionDefined = false;
+    FactorizationPrecision precision{};
+    double                 compressionTolerance{};
+    bool                   matrixFree{};
+    double                 greedyTolerance{};
   };
 
   struct GeoMultiscaleConfiguration {
@@ -115,6 +124,7 @@ public:
   void resetMappings()
   {
     _mappings.clear();
+    _equivalentMappings.clear();
   }
 
 private:
@@ -150,6 +160,9 @@ private:
   const std::string CONSTRAINT_SCALED_CONSISTENT_SURFACE = "scaled-consistent-surface";
   const std::string CONSTRAINT_SCALED_CONSISTENT_VOLUME  = "scaled-consistent-volume";
 
+  // For projection-based mappings
+  const std::string ATTR_CACHE_DIRECTORY = "cache-directory";
+
   // RBF specific options
   const std::string ATTR_X_DEAD = "x-dead";
   const std::string ATTR_Y_DEAD = "y-dead";
@@ -160,6 +173,12 @@ private:
   const std::string POLYNOMIAL_ON       = "on";
   const std::string POLYNOMIAL_OFF      = "off";
 
+  // For direct RBFs
+  const std::string ATTR_MIXED_PRECISION        = "mixed-precision";
+  const std::string ATTR_COMPRESSION_TOLERANCE  = "compression-tolerance";
+  const std::string ATTR_MATRIX_FREE_EVALUATION = "matrix-free-evaluation";
+  const std::string ATTR_GREEDY_TOLERANCE       = "greedy-tolerance";
+
   // For iterative RBFs
   const std::string ATTR_SOLVER_RTOL = "solver-rtol";
 
@@ -172,6 +191,7 @@ private:
   const std::string ATTR_VERTICES_PER_CLUSTER = "vertices-per-cluster";
   const std::string ATTR_RELATIVE_OVERLAP     = "relative-overlap";
   const std::string ATTR_PROJECT_TO_INPUT     = "project-to-input";
+  const std::string ATTR_BALANCE_CLUSTERS     = "balance-clusters";
 
   // We declare the basis function as subtag
   const std::string SUBTAG_BASIS_FUNCTION = "basis-function";
@@ -248,6 +268,12 @@ private:
   // Settings for the iterative solvers provided by Ginkgo
   GinkgoParameter _ginkgoParameter;
 
+  // Operators shared between equivalent RBF mappings of the participant
+  std::shared_ptr<OperatorRegistry> _operatorRegistry = std::make_shared<OperatorRegistry>();
+
+  // The first RBF mapping configured for an operator key, see \ref shareEquivalentOperator()
+  std::map<std::string, PtrMapping> _equivalentMappings;
+
   /**
    * Configures and instantiates all mappings, which do not require
    * a subtag/ a basis function. For the RBF related mappings, this class
@@ -277,10 +303,24 @@ private:
                                        double solverRtol,
                                        double verticesPerCluster,
                                        double relativeOverlap,
-                                       bool   projectToInput) const;
+                                       bool   projectToInput,
+                                       bool   balanceClusters,
+                                       int    nThreads,
+                                       bool   mixedPrecision,
+                                       double compressionTolerance,
+                                       bool   matrixFree,
+                                       double greedyTolerance) const;
 
   void finishRBFConfiguration();
 
+  /**
+   * Lets the latest RBF mapping share its operator with an equivalent mapping configured before.
+   * Mappings are equivalent if they use identical RBF settings and solve the system on the same pair
+   * of meshes, e.g., a consistent mapping from mesh A to mesh B and a conservative mapping from mesh B
+   * to mesh A. The conservative mapping then applies the transpose of the shared operator.
+   */
+  void shareEquivalentOperator();
+
   /// Check whether a mapping to and from the same mesh already exists
   void checkDuplicates(const ConfiguredMapping &mapping);
 
@@ -14,6 +14,16 @@ enum class Polynomial {
   SEPARATE
 };
 
+/// Which floating point precision to use for the decomposition of direct RBF systems?
+/**
+ * DOUBLE: Decompose the system in double precision
+ * MIXED: Decompose the system in single precision and recover double precision using iterative refinement
+ */
+enum class FactorizationPrecision {
+  DOUBLE,
+  MIXED
+};
+
 enum class BasisFunction {
   WendlandC0,
   WendlandC2,
@@ -37,11 +37,44 @@
 #if !defined(__NVCC__) || !defined(__HIPCC__)
 #include "logging/Logger.hpp"
 #endif
+#include <Eigen/Core>
 #include "math/math.hpp"
+#include "precice/span.hpp"
+#include "utils/assertion.hpp"
 
 namespace precice {
 namespace mapping {
 
+namespace impl {
+/**
+ * @brief Views a batch of the batched evaluate functions as Eigen array
+ *
+ * The batched evaluate functions take squared radii, as computed by the matrix assembly, and yield the same values
+ * as operator(). They are formulated as Eigen array expressions, which are evaluated using explicit vectorization,
+ * including the elementary functions sqrt, exp and log.
+ */
+inline Eigen::Map<const Eigen::ArrayXd> asArray(precice::span<const double> batch)
+{
+  return {batch.data(), static_cast<Eigen::Index>(batch.size())};
+}
+
+inline Eigen::Map<Eigen::ArrayXd> asArray(precice::span<double> batch)
+{
+  return {batch.data(), static_cast<Eigen::Index>(batch.size())};
+}
+
+/**
+ * @brief Computes the radii of a batch relative to the support radius, p = r / supportRadius, clamped to 1
+ *
+ * All compactly supported functions vanish at p = 1. Clamping p thus evaluates them to zero outside of
+ * their support without any branches, which keeps the batched evaluation vectorized.
+ */
+inline auto clampedNormalizedRadii(const Eigen::Map<const Eigen::ArrayXd> &squaredRadii, double inverseSupportRadius)
+{
+  return (squaredRadii.sqrt() * inverseSupportRadius).min(1.0);
+}
+} // namespace impl
+
 /**
  * @brief Wrapper struct that is used to transfer RBF-specific parameters to the GPU.
  *
@@ -110,6 +143,15 @@ public:
     return operator()(radius, _params);
   }
 
+  /// Batched version of operator(), which avoids the square root using r^2 log(r) = 0.5 r^2 log(r^2)
+  void evaluate(precice::span<const double> squaredRadii, precice::span<double> values) const
+  {
+    PRECICE_ASSERT(squaredRadii.size() == values.size());
+    const auto r2  = impl::asArray(squaredRadii);
+    auto       out = impl::asArray(values);
+    out = 0.5 * r2 * r2.max(math::pow_int<2>(NUMERICAL_ZERO_DIFFERENCE_DEVICE)).log();
+  }
+
   PRECICE_HOST_DEVICE inline double operator()(const double radius, const RadialBasisParameters params) const
   {
     // We don't need to read any values from params since there is no need here
@@ -146,6 +188,15 @@ public:
     return operator()(radius, _params);
   }
 
+  /// Batched version of operator(), which depends on the squared radius only
+  void evaluate(precice::span<const double> squaredRadii, precice::span<double> values) const
+  {
+    PRECICE_ASSERT(squaredRadii.size() == values.size());
+    const auto r2  = impl::asArray(squaredRadii);
+    auto       out = impl::asArray(values);
+    out = (r2 + _cPow2).sqrt();
+  }
+
   PRECICE_HOST_DEVICE inline double operator()(const double radius, const RadialBasisParameters params) const
   {
     double cPow2 = params.parameter1;
@@ -189,6 +240,15 @@ public:
     return operator()(radius, _params);
   }
 
+  /// Batched version of operator(), the reciprocal of the batched multiquadrics
+  void evaluate(precice::span<const double> squaredRadii, precice::span<double> values) const
+  {
+    PRECICE_ASSERT(squaredRadii.size() == values.size());
+    const auto r2  = impl::asArray(squaredRadii);
+    auto       out = impl::asArray(values);
+    out = (r2 + _cPow2).sqrt().inverse();
+  }
+
   PRECICE_HOST_DEVICE inline double operator()(const double radius, const RadialBasisParameters params) const
   {
     double cPow2 = params.parameter1;
@@ -221,6 +281,15 @@ public:
     return operator()(radius, _params);
   }
 
+  /// Batched version of operator(), which is the square root of the squared radii
+  void evaluate(precice::span<const double> squaredRadii, precice::span<double> values) const
+  {
+    PRECICE_ASSERT(squaredRadii.size() == values.size());
+    const auto r2  = impl::asArray(squaredRadii);
+    auto       out = impl::asArray(values);
+    out = r2.sqrt();
+  }
+
   PRECICE_HOST_DEVICE inline double operator()(const double radius, const RadialBasisParameters params) const
   {
     return std::abs(radius);
@@ -279,6 +348,20 @@ public:
     return operator()(radius, _params);
   }
 
+  /// Batched version of operator(), which truncates the shifted function beyond the support radius
+  void evaluate(precice::span<const double> squaredRadii, precice::span<double> values) const
+  {
+    PRECICE_ASSERT(squaredRadii.size() == values.size());
+    const auto r2  = impl::asArray(squaredRadii);
+    auto       out = impl::asArray(values);
+    out = (r2 * -math::pow_int<2>(_shape)).exp() - _deltaY;
+    // Separate loop without dependencies, which is vectorized by the compiler
+    const double supportRadiusPow2 = math::pow_int<2>(_supportRadius);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      values[i] = squaredRadii[i] > supportRadiusPow2 ? 0.0 : values[i];
+    }
+  }
+
   PRECICE_HOST_DEVICE inline double operator()(const double radius, const RadialBasisParameters params) const
   {
     double shape         = params.parameter1;
@@ -345,6 +428,16 @@ public:
     return operator()(radius, _params);
   }
 
+  /// Batched version of operator(), which guards the logarithm against p = 0
+  void evaluate(precice::span<const double> squaredRadii, precice::span<double> values) const
+  {
+    PRECICE_ASSERT(squaredRadii.size() == values.size());
+    const auto r2  = impl::asArray(squaredRadii);
+    auto       out = impl::asArray(values);
+    const auto p = impl::clampedNormalizedRadii(r2, _r_inv);
+    out          = 1.0 - 30.0 * p.square() - 10.0 * p.cube() + 45.0 * p.square().square() - 6.0 * p.square().square() * p - p.cube() * 60.0 * p.max(NUMERICAL_ZERO_DIFFERENCE_DEVICE).log();
+  }
+
   PRECICE_HOST_DEVICE inline double operator()(const double radius, const RadialBasisParameters params) const
   {
     double       r_inv = params.parameter1;
@@ -398,6 +491,16 @@ public:
     return operator()(radius, _params);
   }
 
+  /// Batched version of operator(), evaluating (1 - p)^2
+  void evaluate(precice::span<const double> squaredRadii, precice::span<double> values) const
+  {
+    PRECICE_ASSERT(squaredRadii.size() == values.size());
+    const auto r2  = impl::asArray(squaredRadii);
+    auto       out = impl::asArray(values);
+    const auto p = impl::clampedNormalizedRadii(r2, _r_inv);
+    out          = (1.0 - p).square();
+  }
+
   PRECICE_HOST_DEVICE inline double operator()(const double radius, const RadialBasisParameters params) const
   {
     double       r_inv = params.parameter1;
@@ -452,6 +555,16 @@ public:
     return operator()(radius, _params);
   }
 
+  /// Batched version of operator(), evaluating (1 - p)^4 (4p + 1)
+  void evaluate(precice::span<const double> squaredRadii, precice::span<double> values) const
+  {
+    PRECICE_ASSERT(squaredRadii.size() == values.size());
+    const auto r2  = impl::asArray(squaredRadii);
+    auto       out = impl::asArray(values);
+    const auto p = impl::clampedNormalizedRadii(r2, _r_inv);
+    out          = (1.0 - p).square().square() * (4.0 * p + 1.0);
+  }
+
   PRECICE_HOST_DEVICE inline double operator()(const double radius, const RadialBasisParameters params) const
   {
     double       r_inv = params.parameter1;
@@ -506,6 +619,16 @@ public:
     return operator()(radius, _params);
   }
 
+  /// Batched version of operator(), evaluating (1 - p)^6 (35p^2 + 18p + 3)
+  void evaluate(precice::span<const double> squaredRadii, precice::span<double> values) const
+  {
+    PRECICE_ASSERT(squaredRadii.size() == values.size());
+    const auto r2  = impl::asArray(squaredRadii);
+    auto       out = impl::asArray(values);
+    const auto p = impl::clampedNormalizedRadii(r2, _r_inv);
+    out          = (1.0 - p).cube().square() * (35.0 * p.square() + 18.0 * p + 3.0);
+  }
+
   PRECICE_HOST_DEVICE inline double operator()(const double radius, const RadialBasisParameters params) const
   {
     double       r_inv = params.parameter1;
@@ -559,6 +682,16 @@ public:
     return operator()(radius, _params);
   }
 
+  /// Batched version of operator(), evaluating (1 - p)^8 (32p^3 + 25p^2 + 8p + 1)
+  void evaluate(precice::span<const double> squaredRadii, precice::span<double> values) const
+  {
+    PRECICE_ASSERT(squaredRadii.size() == values.size());
+    const auto r2  = impl::asArray(squaredRadii);
+    auto       out = impl::asArray(values);
+    const auto p = impl::clampedNormalizedRadii(r2, _r_inv);
+    out          = (1.0 - p).square().square().square() * (32.0 * p.cube() + 25.0 * p.square() + 8.0 * p + 1.0);
+  }
+
   PRECICE_HOST_DEVICE inline double operator()(const double radius, const RadialBasisParameters params) const
   {
     double       r_inv = params.parameter1;
@@ -612,6 +745,16 @@ public:
     return operator()(radius, _params);
   }
 
+  /// Batched version of operator(), evaluating (1 - p)^10 (1287p^4 + 1350p^3 + 630p^2 + 150p + 15)
+  void evaluate(precice::span<const double> squaredRadii, precice::span<double> values) const
+  {
+    PRECICE_ASSERT(squaredRadii.size() == values.size());
+    const auto r2  = impl::asArray(squaredRadii);
+    auto       out = impl::asArray(values);
+    const auto p = impl::clampedNormalizedRadii(r2, _r_inv);
+    out          = ((1.0 - p).square().square() * (1.0 - p)).square() * (1287.0 * p.square().square() + 1350.0 * p.cube() + 630.0 * p.square() + 150.0 * p + 15.0);
+  }
+
   PRECICE_HOST_DEVICE inline double operator()(const double radius, const RadialBasisParameters params) const
   {
     double       r_inv = params.parameter1;
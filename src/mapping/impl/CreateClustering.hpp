@@ -3,6 +3,7 @@
 #include <Eigen/Core>
 
 #include <algorithm>
+#include <numeric>
 
 #include "math/math.hpp"
 #include "mesh/Mesh.hpp"
@@ -208,8 +209,63 @@ void removeTaggedVertices(Vertices &container)
 {
   container.erase(std::remove_if(container.begin(), container.end(), [](auto &v) { return v.isTagged(); }), container.end());
 }
+
+/**
+ * @brief Covers the cell of a cluster, i.e., the cube of half edge length \p cellHalfWidth around the \p center, by a regular
+ * grid of child clusters with the radius \p childRadius . The spacing of the children follows the same overlap condition as the
+ * clustering in \ref createClustering , such that each child covers its own cell.
+ *
+ * @param[in] center center of the parent cluster
+ * @param[in] cellHalfWidth half edge length of the cell covered by the parent cluster
+ * @param[in] childRadius radius of the child clusters
+ * @param[in] relativeOverlap relative overlap between the children
+ *
+ * @return a tuple for the half edge length of the child cells and a vector of vertices marking the child centers
+ */
+std::tuple<double, Vertices> splitCluster(const mesh::Vertex &center, double cellHalfWidth, double childRadius, double relativeOverlap)
+{
+  const int dim = center.getDimensions();
+  // Number of children in each direction, which satisfies the maximum center distance (see createClustering)
+  const int    nChildren = std::ceil(cellHalfWidth / (std::sqrt(1. / dim) * childRadius * (1 - relativeOverlap)));
+  const double distance  = 2 * cellHalfWidth / nChildren;
+
+  Vertices                 children;
+  const Eigen::VectorXd    parentCoords = center.getCoords();
+  const std::array<int, 3> nCells{nChildren, nChildren, dim == 3 ? nChildren : 1};
+  std::array<int, 3>       ids{0, 0, 0};
+  Eigen::VectorXd          childCoords(dim);
+  for (ids[0] = 0; ids[0] < nCells[0]; ++ids[0]) {
+    for (ids[1] = 0; ids[1] < nCells[1]; ++ids[1]) {
+      for (ids[2] = 0; ids[2] < nCells[2]; ++ids[2]) {
+        for (int d = 0; d < dim; ++d) {
+          childCoords(d) = parentCoords(d) - cellHalfWidth + (ids[d] + 0.5) * distance;
+        }
+        children.emplace_back(childCoords, static_cast<VertexID>(children.size()));
+      }
+    }
+  }
+  return {0.5 * distance, children};
+}
 } // namespace
 
+/// Relative tolerance band around the target number of vertices per cluster, see \ref balanceClustering
+constexpr double clusterSizeTolerance = 0.5;
+
+/// Maximum number of recursive splits of a single cluster, see \ref balanceClustering
+constexpr int maxClusterSplitLevels = 3;
+
+/// Maximum factor by which \ref balanceClustering grows the radius of a cluster
+constexpr double maxClusterGrowth = 2.;
+
+/**
+ * @brief Estimates the relative computational cost of a cluster with the given number of input vertices. The cost is
+ * dominated by the decomposition of the dense interpolation matrix, which scales cubically with the cluster size.
+ */
+constexpr double estimateClusterCost(std::size_t nVertices)
+{
+  return math::pow_int<3>(static_cast<double>(nVertices));
+}
+
 /**
  * @brief Computes an estimate for the cluster radius, which results in approximately \p verticesPerCluster vertices inside
  * of each cluster. The algorithm generates random samples in the domain and queries the \p verticesPerCluster nearest-neighbors
@@ -495,6 +551,106 @@ inline std::tuple<double, Vertices> createClustering(mesh::PtrMesh inMesh, mesh:
 
   return {clusterRadius, centers};
 }
+
+/**
+ * @brief Balances the cost of a clustering created by \ref createClustering , where all clusters share the same radius.
+ * Since the radius is estimated from a few samples only, the number of vertices per cluster varies with the point density
+ * of the \p inMesh , and the cubically growing cost of a few large clusters might dominate the overall cost.
+ *
+ * The function keeps the number of input vertices of each cluster close to the band
+ * [ \p verticesPerCluster / (1 + \p sizeTolerance ), \p verticesPerCluster * (1 + \p sizeTolerance ) ]:
+ * - Clusters above the band are replaced by smaller child clusters covering the cell of the cluster (see \ref splitCluster ).
+ *   The child radius assumes a locally uniform point density. The split is only applied if the estimated cost of the
+ *   non-empty children (see \ref estimateClusterCost ) is lower than the cost of the cluster. Children are split
+ *   recursively up to \ref maxClusterSplitLevels times.
+ * - Clusters below the band grow their radius up to \ref maxClusterGrowth times the radius of the initial clustering,
+ *   such that they contain enough vertices. Tagging the input mesh thus requires a correspondingly larger margin.
+ *
+ * Both operations preserve the coverage of the domain. Without projection, the cells of the initial clustering are the
+ * cells of the regular grid of centers. Projected centers cover the bounding box of their sphere instead. Child clusters
+ * are not projected to the input mesh.
+ *
+ * @param[in,out] centers the cluster centers, which are replaced by the balanced cluster centers
+ * @param[in] clusterRadius the common radius of the given \p centers
+ * @param[in] inMesh The input mesh, on which the clustering was computed
+ * @param[in] outMesh The output mesh, used to filter empty clusters
+ * @param[in] relativeOverlap Relative overlap between clusters, see \ref createClustering
+ * @param[in] verticesPerCluster Target number of vertices per partition
+ * @param[in] projectClustersToInput whether the \p centers were projected to the \p inMesh , see \ref createClustering
+ * @param[in] sizeTolerance Relative tolerance band around \p verticesPerCluster
+ *
+ * @return the radius of each of the balanced \p centers
+ */
+inline std::vector<double> balanceClustering(Vertices &centers, double clusterRadius, mesh::PtrMesh inMesh, mesh::PtrMesh outMesh,
+                                             double relativeOverlap, unsigned int verticesPerCluster, bool projectClustersToInput,
+                                             double sizeTolerance = clusterSizeTolerance)
+{
+  precice::logging::Logger _log{"impl::balanceClustering"};
+  PRECICE_TRACE();
+  PRECICE_ASSERT(sizeTolerance >= 0);
+
+  // The single cluster of small meshes (see createClustering) covers the whole domain by construction
+  if (centers.size() <= 1) {
+    return std::vector<double>(centers.size(), clusterRadius);
+  }
+
+  const int    dim        = inMesh->getDimensions();
+  const double upperBound = verticesPerCluster * (1 + sizeTolerance);
+  const auto   lowerBound = static_cast<int>(std::ceil(verticesPerCluster / (1 + sizeTolerance)));
+
+  Vertices            balancedCenters;
+  std::vector<double> radii;
+  std::size_t         nSplit = 0, nGrown = 0;
+
+  const auto addCluster = [&](const mesh::Vertex &center, double radius, std::size_t nVertices) {
+    if (static_cast<int>(nVertices) < lowerBound) {
+      // The query returns the closest vertices sorted by distance, whereas the radius queries exclude the edge
+      const auto   closestIDs = inMesh->index().getClosestVertices(center.getCoords(), lowerBound);
+      const double distance   = std::sqrt(computeSquaredDifference(center.rawCoords(), inMesh->vertex(closestIDs.back()).rawCoords()));
+      const double grown      = std::min(maxClusterGrowth * clusterRadius, distance + math::NUMERICAL_ZERO_DIFFERENCE);
+      if (grown > radius) {
+        radius = grown;
+        ++nGrown;
+      }
+    }
+    balancedCenters.emplace_back(center.getCoords(), static_cast<VertexID>(balancedCenters.size()));
+    radii.push_back(radius);
+  };
+
+  // Recursively splits overloaded clusters
+  const auto balance = [&](const auto &self, const mesh::Vertex &center, double radius, double cellHalfWidth, std::size_t nVertices, int level) -> void {
+    if (nVertices > upperBound && level < maxClusterSplitLevels) {
+      const double childRadius                  = radius * std::pow(static_cast<double>(verticesPerCluster) / nVertices, 1. / dim);
+      auto [childCellHalfWidth, children]       = splitCluster(center, cellHalfWidth, childRadius, relativeOverlap);
+      tagEmptyClusters(children, childRadius, inMesh);
+      tagEmptyClusters(children, childRadius, outMesh);
+      removeTaggedVertices(children);
+
+      std::vector<std::size_t> childSizes(children.size());
+      std::transform(children.begin(), children.end(), childSizes.begin(), [&](const auto &child) { return inMesh->index().getVerticesInsideBox(child, childRadius).size(); });
+      const double childCost = std::accumulate(childSizes.begin(), childSizes.end(), 0., [](double cost, std::size_t size) { return cost + estimateClusterCost(size); });
+
+      if (!children.empty() && childCost < estimateClusterCost(nVertices)) {
+        ++nSplit;
+        for (std::size_t i = 0; i < children.size(); ++i) {
+          self(self, children[i], childRadius, childCellHalfWidth, childSizes[i], level + 1);
+        }
+        return;
+      }
+    }
+    addCluster(center, radius, nVertices);
+  };
+
+  // The largest cell of the regular grid in createClustering, which is covered by the cluster radius
+  const double cellHalfWidth = projectClustersToInput ? clusterRadius : std::sqrt(1. / dim) * clusterRadius * (1 - relativeOverlap);
+  for (const auto &center : centers) {
+    balance(balance, center, clusterRadius, cellHalfWidth, inMesh->index().getVerticesInsideBox(center, clusterRadius).size(), 0);
+  }
+  PRECICE_DEBUG("Balanced the clustering: split {} and grew {} clusters, resulting in {} clusters", nSplit, nGrown, balancedCenters.size());
+
+  centers = std::move(balancedCenters);
+  return radii;
+}
 } // namespace impl
 } // namespace mapping
 } // namespace precice
@@ -0,0 +1,390 @@
+#include "mapping/impl/HierarchicalMatrix.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+#include "utils/assertion.hpp"
+
+namespace precice::mapping::impl {
+
+ClusterTree::ClusterTree(const Eigen::Matrix3Xd &coordinates, Eigen::Index leafSize)
+    : _permutation(coordinates.cols()),
+      _coordinates(coordinates)
+{
+  PRECICE_ASSERT(leafSize > 0, leafSize);
+  std::iota(_permutation.begin(), _permutation.end(), Eigen::Index{0});
+  if (coordinates.cols() > 0) {
+    build(0, coordinates.cols(), leafSize);
+  }
+
+  // Store the coordinates in the permuted order, such that clusters are contiguous
+  for (Eigen::Index i = 0; i < coordinates.cols(); ++i) {
+    _coordinates.col(i) = coordinates.col(_permutation[i]);
+  }
+}
+
+int ClusterTree::build(Eigen::Index begin, Eigen::Index size, Eigen::Index leafSize)
+{
+  // The coordinates are still stored in the original order during the construction
+  const auto first = _permutation.begin() + begin;
+  const auto last  = first + size;
+
+  Eigen::Vector3d lower = Eigen::Vector3d::Constant(std::numeric_limits<double>::max());
+  Eigen::Vector3d upper = Eigen::Vector3d::Constant(std::numeric_limits<double>::lowest());
+  for (auto it = first; it != last; ++it) {
+    lower = lower.cwiseMin(_coordinates.col(*it));
+    upper = upper.cwiseMax(_coordinates.col(*it));
+  }
+
+  const int id = _clusters.size();
+  _clusters.push_back(Cluster{begin, size, 0.5 * (lower + upper), 0.5 * (upper - lower).norm()});
+  if (size <= leafSize) {
+    return id;
+  }
+
+  // Bisect at the median along the largest extent of the bounding box
+  Eigen::Index axis;
+  (upper - lower).maxCoeff(&axis);
+  const auto middle = first + size / 2;
+  std::nth_element(first, middle, last, [this, axis](Eigen::Index a, Eigen::Index b) {
+    return _coordinates(axis, a) < _coordinates(axis, b);
+  });
+
+  const int left  = build(begin, size / 2, leafSize);
+  const int right = build(begin + size / 2, size - size / 2, leafSize);
+  // The vector may have been reallocated by the recursive calls
+  _clusters[id].children = {{left, right}};
+  return id;
+}
+
+const ClusterTree::Cluster &ClusterTree::cluster(int id) const
+{
+  PRECICE_ASSERT(id >= 0 && id < nClusters(), id, nClusters());
+  return _clusters[id];
+}
+
+int ClusterTree::nClusters() const
+{
+  return _clusters.size();
+}
+
+Eigen::Index ClusterTree::size() const
+{
+  return _permutation.size();
+}
+
+const Eigen::Matrix3Xd &ClusterTree::coordinates() const
+{
+  return _coordinates;
+}
+
+Eigen::MatrixXd ClusterTree::permute(const Eigen::MatrixXd &data) const
+{
+  PRECICE_ASSERT(data.rows() == size(), data.rows(), size());
+  Eigen::MatrixXd result(data.rows(), data.cols());
+  for (Eigen::Index i = 0; i < size(); ++i) {
+    result.row(i) = data.row(_permutation[i]);
+  }
+  return result;
+}
+
+Eigen::MatrixXd ClusterTree::unpermute(const Eigen::MatrixXd &data) const
+{
+  PRECICE_ASSERT(data.rows() == size(), data.rows(), size());
+  Eigen::MatrixXd result(data.rows(), data.cols());
+  for (Eigen::Index i = 0; i < size(); ++i) {
+    result.row(_permutation[i]) = data.row(i);
+  }
+  return result;
+}
+
+bool adaptiveCrossApproximation(const BlockEvaluator &evaluate, Eigen::Index rowBegin, Eigen::Index rows, Eigen::Index colBegin, Eigen::Index cols,
+                                double tolerance, Eigen::Index maxRank, Eigen::MatrixXd &U, Eigen::MatrixXd &V)
+{
+  PRECICE_ASSERT(maxRank >= 0 && maxRank <= std::min(rows, cols), maxRank, rows, cols);
+  Eigen::MatrixXd crossU(rows, maxRank);
+  Eigen::MatrixXd crossV(cols, maxRank);
+  Eigen::MatrixXd row(1, cols);
+  Eigen::MatrixXd column(rows, 1);
+
+  std::vector<bool> usedRows(rows, false);
+  Eigen::Index      pivotRow = 0;
+  Eigen::Index      rank     = 0;
+  // Estimate of the squared Frobenius norm of the approximation
+  double approximationNorm2 = 0;
+
+  while (pivotRow >= 0) {
+    usedRows[pivotRow] = true;
+
+    // Residual of the pivot row
+    evaluate(rowBegin + pivotRow, colBegin, row);
+    Eigen::VectorXd v = row.transpose() - crossV.leftCols(rank) * crossU.row(pivotRow).head(rank).transpose();
+
+    Eigen::Index pivotCol;
+    const double pivot = v.cwiseAbs().maxCoeff(&pivotCol);
+
+    if (pivot > 0) {
+      if (rank == maxRank) {
+        return false;
+      }
+      v /= v(pivotCol);
+
+      // Residual of the pivot column
+      evaluate(rowBegin, colBegin + pivotCol, column);
+      const Eigen::VectorXd u = column - crossU.leftCols(rank) * crossV.row(pivotCol).head(rank).transpose();
+
+      const double crossNorm2 = u.squaredNorm() * v.squaredNorm();
+      approximationNorm2 += crossNorm2 + 2 * (crossU.leftCols(rank).transpose() * u).dot(crossV.leftCols(rank).transpose() * v);
+      crossU.col(rank) = u;
+      crossV.col(rank) = v;
+      ++rank;
+
+      if (crossNorm2 <= tolerance * tolerance * approximationNorm2) {
+        break;
+      }
+    }
+
+    // Continue with the unused row of the largest entry in the last cross
+    pivotRow      = -1;
+    double maxRow = -1;
+    for (Eigen::Index i = 0; i < rows; ++i) {
+      const double entry = rank > 0 ? std::abs(crossU(i, rank - 1)) : 0.;
+      if (!usedRows[i] && entry > maxRow) {
+        pivotRow = i;
+        maxRow   = entry;
+      }
+    }
+  }
+
+  U = crossU.leftCols(rank);
+  V = crossV.leftCols(rank);
+  return true;
+}
+
+HODLRMatrix::HODLRMatrix(std::shared_ptr<const ClusterTree> tree, const BlockEvaluator &evaluate, double tolerance)
+    : _tree(std::move(tree)),
+      _invertible(true)
+{
+  PRECICE_ASSERT(_tree);
+  _nodes.resize(_tree->nClusters());
+  if (_tree->size() > 0) {
+    factorize(ClusterTree::root, evaluate, tolerance);
+  }
+}
+
+void HODLRMatrix::factorize(int id, const BlockEvaluator &evaluate, double tolerance)
+{
+  const auto &cluster = _tree->cluster(id);
+  Node &      node    = _nodes[id];
+
+  if (cluster.isLeaf()) {
+    Eigen::MatrixXd block(cluster.size, cluster.size);
+    evaluate(cluster.begin, cluster.begin, block);
+    node.leaf.compute(block);
+    _invertible = _invertible && node.leaf.isInvertible();
+    return;
+  }
+
+  const auto &first  = _tree->cluster(cluster.children[0]);
+  const auto &second = _tree->cluster(cluster.children[1]);
+  factorize(cluster.children[0], evaluate, tolerance);
+  factorize(cluster.children[1], evaluate, tolerance);
+
+  // Store the off-diagonal block exactly as U * I, if it cannot be compressed
+  if (!adaptiveCrossApproximation(evaluate, first.begin, first.size, second.begin, second.size, tolerance, std::min(first.size, second.size), node.U, node.V)) {
+    node.U.resize(first.size, second.size);
+    evaluate(first.begin, second.begin, node.U);
+    node.V = Eigen::MatrixXd::Identity(second.size, second.size);
+  }
+
+  // Sherman-Morrison-Woodbury: A = D + W * X^T with D = diag(A11, A22), W = diag(U, V) and X^T = [0 V^T; U^T 0]
+  const Eigen::Index rank = node.U.cols();
+  if (rank == 0) {
+    return;
+  }
+  node.Z1 = solveBlock(cluster.children[0], node.U);
+  node.Z2 = solveBlock(cluster.children[1], node.V);
+
+  Eigen::MatrixXd    capacitance(2 * rank, 2 * rank);
+  capacitance << Eigen::MatrixXd::Identity(rank, rank), node.V.transpose() * node.Z2,
+      node.U.transpose() * node.Z1, Eigen::MatrixXd::Identity(rank, rank);
+  node.capacitance.compute(capacitance);
+  _invertible = _invertible && node.capacitance.isInvertible();
+}
+
+Eigen::MatrixXd HODLRMatrix::solveBlock(int id, const Eigen::MatrixXd &rhs) const
+{
+  const auto &cluster = _tree->cluster(id);
+  const Node &node    = _nodes[id];
+  PRECICE_ASSERT(rhs.rows() == cluster.size, rhs.rows(), cluster.size);
+
+  if (cluster.isLeaf()) {
+    return node.leaf.solve(rhs);
+  }
+
+  const Eigen::Index    firstSize = _tree->cluster(cluster.children[0]).size;
+  const Eigen::MatrixXd first     = solveBlock(cluster.children[0], rhs.topRows(firstSize));
+  const Eigen::MatrixXd second    = solveBlock(cluster.children[1], rhs.bottomRows(cluster.size - firstSize));
+
+  const Eigen::Index rank = node.U.cols();
+  Eigen::MatrixXd    result(rhs.rows(), rhs.cols());
+  if (rank == 0) {
+    result << first, second;
+    return result;
+  }
+
+  Eigen::MatrixXd coupling(2 * rank, rhs.cols());
+  coupling << node.V.transpose() * second, node.U.transpose() * first;
+  const Eigen::MatrixXd correction = node.capacitance.solve(coupling);
+
+  result.topRows(firstSize)                   = first - node.Z1 * correction.topRows(rank);
+  result.bottomRows(cluster.size - firstSize) = second - node.Z2 * correction.bottomRows(rank);
+  return result;
+}
+
+Eigen::MatrixXd HODLRMatrix::solve(const Eigen::MatrixXd &rhs) const
+{
+  PRECICE_ASSERT(rhs.rows() == rows(), rhs.rows(), rows());
+  if (rows() == 0) {
+    return rhs;
+  }
+  return _tree->unpermute(solveBlock(ClusterTree::root, _tree->permute(rhs)));
+}
+
+bool HODLRMatrix::isInvertible() const
+{
+  return _invertible;
+}
+
+Eigen::Index HODLRMatrix::rows() const
+{
+  return _tree ? _tree->size() : 0;
+}
+
+Eigen::Index HODLRMatrix::storedEntries() const
+{
+  Eigen::Index entries = 0;
+  for (int id = 0; id < static_cast<int>(_nodes.size()); ++id) {
+    const Node &node = _nodes[id];
+    // Decompositions are only computed for leaves and non-zero off-diagonal blocks
+    if (_tree->cluster(id).isLeaf()) {
+      entries += node.leaf.matrixQR().size();
+    } else if (node.U.cols() > 0) {
+      entries += node.U.size() + node.V.size() + node.Z1.size() + node.Z2.size() + node.capacitance.matrixQR().size();
+    }
+  }
+  return entries;
+}
+
+HierarchicalMatrix::HierarchicalMatrix(std::shared_ptr<const ClusterTree> rowTree, std::shared_ptr<const ClusterTree> colTree, const BlockEvaluator &evaluate, double tolerance)
+    : _rowTree(std::move(rowTree)),
+      _colTree(std::move(colTree))
+{
+  PRECICE_ASSERT(_rowTree && _colTree);
+  if (_rowTree->size() > 0 && _colTree->size() > 0) {
+    build(ClusterTree::root, ClusterTree::root, evaluate, tolerance);
+  }
+}
+
+void HierarchicalMatrix::build(int rowCluster, int colCluster, const BlockEvaluator &evaluate, double tolerance)
+{
+  const auto &row = _rowTree->cluster(rowCluster);
+  const auto &col = _colTree->cluster(colCluster);
+
+  const double distance   = (row.center - col.center).norm() - row.radius - col.radius;
+  const bool   admissible = 2 * std::max(row.radius, col.radius) <= admissibility * distance;
+
+  // The low-rank representation only pays off up to half of the full rank
+  if (admissible) {
+    Block block{rowCluster, colCluster, {}, {}, true};
+    if (adaptiveCrossApproximation(evaluate, row.begin, row.size, col.begin, col.size, tolerance, std::min(row.size, col.size) / 2, block.U, block.V)) {
+      _blocks.push_back(std::move(block));
+      return;
+    }
+  }
+
+  if (row.isLeaf() && col.isLeaf()) {
+    Block block{rowCluster, colCluster, Eigen::MatrixXd(row.size, col.size), {}, false};
+    evaluate(row.begin, col.begin, block.U);
+    _blocks.push_back(std::move(block));
+  } else if (row.isLeaf()) {
+    for (int child : col.children) {
+      build(rowCluster, child, evaluate, tolerance);
+    }
+  } else if (col.isLeaf()) {
+    for (int child : row.children) {
+      build(child, colCluster, evaluate, tolerance);
+    }
+  } else {
+    for (int rowChild : row.children) {
+      for (int colChild : col.children) {
+        build(rowChild, colChild, evaluate, tolerance);
+      }
+    }
+  }
+}
+
+Eigen::MatrixXd HierarchicalMatrix::apply(const Eigen::MatrixXd &x) const
+{
+  PRECICE_ASSERT(x.rows() == cols(), x.rows(), cols());
+  if (rows() == 0 || cols() == 0) {
+    return Eigen::MatrixXd::Zero(rows(), x.cols());
+  }
+  const Eigen::MatrixXd permuted = _colTree->permute(x);
+  Eigen::MatrixXd       result   = Eigen::MatrixXd::Zero(rows(), x.cols());
+  for (const auto &block : _blocks) {
+    const auto &row    = _rowTree->cluster(block.rowCluster);
+    const auto &col    = _colTree->cluster(block.colCluster);
+    const auto  xBlock = permuted.middleRows(col.begin, col.size);
+    if (block.lowRank) {
+      result.middleRows(row.begin, row.size).noalias() += block.U * (block.V.transpose() * xBlock);
+    } else {
+      result.middleRows(row.begin, row.size).noalias() += block.U * xBlock;
+    }
+  }
+  return _rowTree->unpermute(result);
+}
+
+Eigen::MatrixXd HierarchicalMatrix::applyTransposed(const Eigen::MatrixXd &x) const
+{
+  PRECICE_ASSERT(x.rows() == rows(), x.rows(), rows());
+  if (rows() == 0 || cols() == 0) {
+    return Eigen::MatrixXd::Zero(cols(), x.cols());
+  }
+  const Eigen::MatrixXd permuted = _rowTree->permute(x);
+  Eigen::MatrixXd       result   = Eigen::MatrixXd::Zero(cols(), x.cols());
+  for (const auto &block : _blocks) {
+    const auto &row    = _rowTree->cluster(block.rowCluster);
+    const auto &col    = _colTree->cluster(block.colCluster);
+    const auto  xBlock = permuted.middleRows(row.begin, row.size);
+    if (block.lowRank) {
+      result.middleRows(col.begin, col.size).noalias() += block.V * (block.U.transpose() * xBlock);
+    } else {
+      result.middleRows(col.begin, col.size).noalias() += block.U.transpose() * xBlock;
+    }
+  }
+  return _colTree->unpermute(result);
+}
+
+Eigen::Index HierarchicalMatrix::rows() const
+{
+  return _rowTree ? _rowTree->size() : 0;
+}
+
+Eigen::Index HierarchicalMatrix::cols() const
+{
+  return _colTree ? _colTree->size() : 0;
+}
+
+Eigen::Index HierarchicalMatrix::storedEntries() const
+{
+  Eigen::Index entries = 0;
+  for (const auto &block : _blocks) {
+    entries += block.U.size() + block.V.size();
+  }
+  return entries;
+}
+
+} // namespace precice::mapping::impl
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <array>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Binary tree of geometric clusters of vertices
+ *
+ * The tree is constructed by recursively bisecting the bounding box of the vertices along its largest extent,
+ * such that both halves contain the same number of vertices. The vertices are reordered accordingly, such that
+ * every cluster refers to a contiguous range of the permuted vertices.
+ */
+class ClusterTree {
+public:
+  struct Cluster {
+    /// First permuted vertex of the cluster
+    Eigen::Index begin;
+
+    /// Number of vertices in the cluster
+    Eigen::Index size;
+
+    /// Center and radius of the bounding sphere of the cluster's bounding box
+    Eigen::Vector3d center;
+    double          radius;
+
+    /// Indices of the children in the tree, -1 for leaves
+    std::array<int, 2> children{{-1, -1}};
+
+    bool isLeaf() const
+    {
+      return children[0] < 0;
+    }
+  };
+
+  ClusterTree() = default;
+
+  /**
+   * @brief Constructs the tree for the given vertices
+   *
+   * @param[in] coordinates The vertex coordinates stored column-wise
+   * @param[in] leafSize Clusters with at most this number of vertices are not bisected further
+   */
+  ClusterTree(const Eigen::Matrix3Xd &coordinates, Eigen::Index leafSize);
+
+  /// Index of the root cluster
+  static constexpr int root = 0;
+
+  const Cluster &cluster(int id) const;
+
+  /// Number of clusters in the tree
+  int nClusters() const;
+
+  /// Number of vertices in the tree
+  Eigen::Index size() const;
+
+  /// The vertex coordinates in the permuted order
+  const Eigen::Matrix3Xd &coordinates() const;
+
+  /// Reorders the rows of the given data from the original into the permuted order
+  Eigen::MatrixXd permute(const Eigen::MatrixXd &data) const;
+
+  /// Reorders the rows of the given data from the permuted into the original order
+  Eigen::MatrixXd unpermute(const Eigen::MatrixXd &data) const;
+
+private:
+  /// Bisects the given range of permuted vertices recursively and returns the index of the created cluster
+  int build(Eigen::Index begin, Eigen::Index size, Eigen::Index leafSize);
+
+  std::vector<Cluster> _clusters;
+
+  /// Maps permuted positions to original vertex positions
+  std::vector<Eigen::Index> _permutation;
+
+  Eigen::Matrix3Xd _coordinates;
+};
+
+/// Fills the given (pre-sized) block with the matrix entries starting at the given permuted row and column
+using BlockEvaluator = std::function<void(Eigen::Index rowBegin, Eigen::Index colBegin, Eigen::MatrixXd &block)>;
+
+/**
+ * @brief Approximates a block of a matrix by a low-rank product U * V^T using adaptive cross approximation
+ *
+ * Uses partial pivoting, such that only the crosses (rows and columns) of the block are evaluated.
+ *
+ * @param[in] tolerance Relative accuracy of the approximation in the Frobenius norm
+ * @param[in] maxRank Rank at which the approximation is aborted
+ *
+ * @return true if the approximation reached the tolerance with a rank of at most maxRank
+ */
+bool adaptiveCrossApproximation(const BlockEvaluator &evaluate, Eigen::Index rowBegin, Eigen::Index rows, Eigen::Index colBegin, Eigen::Index cols,
+                                double tolerance, Eigen::Index maxRank, Eigen::MatrixXd &U, Eigen::MatrixXd &V);
+
+/**
+ * @brief Hierarchically off-diagonal low-rank (HODLR) approximation of a symmetric matrix with a direct solver
+ *
+ * The matrix is partitioned along a cluster tree. On every level, the diagonal blocks are split further, while the
+ * off-diagonal blocks are approximated by low-rank products. The leaves on the diagonal are stored densely.
+ * The approximation is factorized bottom-up using the Sherman-Morrison-Woodbury formula, such that a solve requires
+ * only operations on the leaves and on the low-rank factors.
+ */
+class HODLRMatrix {
+public:
+  HODLRMatrix() = default;
+
+  /**
+   * @brief Approximates and factorizes the matrix given by the evaluator
+   *
+   * @param[in] tree The cluster tree of the rows and columns
+   * @param[in] evaluate Computes the entries of the matrix in the permuted order of the tree
+   * @param[in] tolerance Relative accuracy of the low-rank blocks
+   */
+  HODLRMatrix(std::shared_ptr<const ClusterTree> tree, const BlockEvaluator &evaluate, double tolerance);
+
+  /// Solves the system for all columns of rhs, which are given in the original order
+  Eigen::MatrixXd solve(const Eigen::MatrixXd &rhs) const;
+
+  /// Returns false if a leaf or a coupling of the factorization is singular
+  bool isInvertible() const;
+
+  Eigen::Index rows() const;
+
+  /// Number of stored matrix entries, including the factorization
+  Eigen::Index storedEntries() const;
+
+private:
+  struct Node {
+    /// Decomposition of the dense diagonal block (leaves only)
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXd> leaf;
+
+    /// Low-rank approximation of the upper off-diagonal block A12 = U * V^T, where A21 = V * U^T by symmetry
+    Eigen::MatrixXd U;
+    Eigen::MatrixXd V;
+
+    /// The low-rank factors multiplied with the inverse diagonal blocks, Z1 = A11^-1 U and Z2 = A22^-1 V
+    Eigen::MatrixXd Z1;
+    Eigen::MatrixXd Z2;
+
+    /// Decomposition of the capacitance matrix of the Sherman-Morrison-Woodbury formula
+    Eigen::ColPivHouseholderQR<Eigen::MatrixXd> capacitance;
+  };
+
+  /// Approximates and factorizes the diagonal block of the given cluster
+  void factorize(int id, const BlockEvaluator &evaluate, double tolerance);
+
+  /// Solves the diagonal block of the given cluster for rhs given in the permuted order
+  Eigen::MatrixXd solveBlock(int id, const Eigen::MatrixXd &rhs) const;
+
+  std::shared_ptr<const ClusterTree> _tree;
+
+  /// Nodes of the factorization, indexed like the clusters of the tree
+  std::vector<Node> _nodes;
+
+  bool _invertible = false;
+};
+
+/**
+ * @brief Hierarchical approximation of a general matrix for fast matrix-vector products
+ *
+ * The block cluster tree of the row and column cluster trees is refined until blocks are either admissible, i.e.,
+ * far apart compared to their size, or the clusters are leaves. Admissible blocks are approximated by low-rank
+ * products, all others are stored densely.
+ */
+class HierarchicalMatrix {
+public:
+  HierarchicalMatrix() = default;
+
+  /**
+   * @brief Approximates the matrix given by the evaluator
+   *
+   * @param[in] rowTree, colTree The cluster trees of the rows and columns
+   * @param[in] evaluate Computes the entries of the matrix in the permuted orders of the trees
+   * @param[in] tolerance Relative accuracy of the low-rank blocks
+   */
+  HierarchicalMatrix(std::shared_ptr<const ClusterTree> rowTree, std::shared_ptr<const ClusterTree> colTree, const BlockEvaluator &evaluate, double tolerance);
+
+  /// Computes A * x, where the rows of x and the result are in the original order
+  Eigen::MatrixXd apply(const Eigen::MatrixXd &x) const;
+
+  /// Computes A^T * x, where the rows of x and the result are in the original order
+  Eigen::MatrixXd applyTransposed(const Eigen::MatrixXd &x) const;
+
+  Eigen::Index rows() const;
+
+  Eigen::Index cols() const;
+
+  /// Number of stored matrix entries
+  Eigen::Index storedEntries() const;
+
+private:
+  /// Blocks are admissible if the larger diameter is at most this factor times their distance
+  static constexpr double admissibility = 2.0;
+
+  struct Block {
+    int rowCluster;
+    int colCluster;
+
+    /// The block is given by U * V^T if it is low-rank, and by U otherwise
+    Eigen::MatrixXd U;
+    Eigen::MatrixXd V;
+    bool            lowRank;
+  };
+
+  /// Refines the block of the given clusters recursively
+  void build(int rowCluster, int colCluster, const BlockEvaluator &evaluate, double tolerance);
+
+  std::shared_ptr<const ClusterTree> _rowTree;
+  std::shared_ptr<const ClusterTree> _colTree;
+
+  /// The leaves of the block cluster tree
+  std::vector<Block> _blocks;
+};
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
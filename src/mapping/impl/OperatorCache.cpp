@@ -0,0 +1,84 @@
+#include "mapping/impl/OperatorCache.hpp"
+
+#include <boost/container_hash/hash.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <fmt/format.h>
+#include <random>
+
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Tetrahedron.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/IntraComm.hpp"
+
+namespace precice::mapping::impl {
+
+std::uint64_t hashMesh(const mesh::Mesh &mesh)
+{
+  std::size_t seed = 0;
+  boost::hash_combine(seed, mesh.getDimensions());
+  boost::hash_combine(seed, mesh.nVertices());
+  for (const auto &vertex : mesh.vertices()) {
+    for (int d = 0; d < mesh.getDimensions(); ++d) {
+      boost::hash_combine(seed, vertex.coord(d));
+    }
+    boost::hash_combine(seed, vertex.getGlobalIndex());
+    boost::hash_combine(seed, vertex.isOwner());
+  }
+
+  boost::hash_combine(seed, mesh.edges().size());
+  for (const auto &edge : mesh.edges()) {
+    for (int i = 0; i < 2; ++i) {
+      boost::hash_combine(seed, edge.vertex(i).getID());
+    }
+  }
+  boost::hash_combine(seed, mesh.triangles().size());
+  for (const auto &triangle : mesh.triangles()) {
+    for (int i = 0; i < 3; ++i) {
+      boost::hash_combine(seed, triangle.vertex(i).getID());
+    }
+  }
+  boost::hash_combine(seed, mesh.tetrahedra().size());
+  for (const auto &tetra : mesh.tetrahedra()) {
+    for (int i = 0; i < 4; ++i) {
+      boost::hash_combine(seed, tetra.vertex(i).getID());
+    }
+  }
+  return seed;
+}
+
+std::string OperatorCache::temporaryFile(const std::string &file)
+{
+  // Concurrent writers of the same operator, such as several runs sharing the cache, must not clobber each other
+  return fmt::format("{}.{}-{:08x}.tmp", file, utils::IntraComm::getRank(), std::random_device{}());
+}
+
+std::ofstream OperatorCache::open(const std::string &temporary)
+{
+  const auto directory = std::filesystem::path(temporary).parent_path();
+  std::error_code ec;
+  if (!directory.empty()) {
+    std::filesystem::create_directories(directory, ec);
+  }
+  return std::ofstream(temporary, std::ios::binary | std::ios::trunc);
+}
+
+bool OperatorCache::commit(const std::string &temporary, const std::string &file, std::ofstream &out)
+{
+  out.close();
+  if (!out) {
+    std::remove(temporary.c_str());
+    return false;
+  }
+  // Renaming is atomic, such that concurrent runs never read partially written files
+  std::error_code ec;
+  std::filesystem::rename(temporary, file, ec);
+  if (ec) {
+    std::remove(temporary.c_str());
+  }
+  return !ec;
+}
+
+} // namespace precice::mapping::impl
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "mesh/SharedPointer.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Computes a hash of the given mesh, which identifies the geometry and the partition of the mesh
+ *
+ * The hash covers the vertex coordinates, the global indices and the ownership of the vertices as well as
+ * the connectivity of the mesh.
+ */
+std::uint64_t hashMesh(const mesh::Mesh &mesh);
+
+/**
+ * @brief Binary file storage for the flat arrays of a computed mapping operator
+ *
+ * A file contains a header and the key identifying the operator, followed by the arrays in the order
+ * they were passed to write(). Each array is stored with its element size and its length, which allows
+ * to detect corrupted or incompatible files when reading. Files with a different key are rejected.
+ */
+class OperatorCache {
+public:
+  /// Writes the key and the given arrays to the file, returns false if the file could not be written
+  template <typename... Arrays>
+  static bool write(const std::string &file, const std::string &key, const Arrays &... arrays);
+
+  /// Reads the given arrays from the file, returns false if the file doesn't exist or doesn't match the key or the arrays
+  template <typename... Arrays>
+  static bool read(const std::string &file, const std::string &key, Arrays &... arrays);
+
+private:
+  /// Identifies operator cache files
+  static constexpr std::uint64_t MAGIC = 0x5043434D4150504FULL;
+
+  /// Increased on every change of the file layout
+  static constexpr std::uint64_t VERSION = 2;
+
+  /// Returns a temporary file name next to the given file, which is unique for every writer
+  static std::string temporaryFile(const std::string &file);
+
+  /// Opens the temporary file for writing, which is moved to the final location by commit()
+  static std::ofstream open(const std::string &temporary);
+
+  /// Moves the written temporary file to its final location
+  static bool commit(const std::string &temporary, const std::string &file, std::ofstream &out);
+
+  template <typename T>
+  static void writeArray(std::ofstream &out, const std::vector<T> &array);
+
+  template <typename T>
+  static bool readArray(std::ifstream &in, std::vector<T> &array);
+};
+
+// --------------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template <typename... Arrays>
+bool OperatorCache::write(const std::string &file, const std::string &key, const Arrays &... arrays)
+{
+  const std::string temporary = temporaryFile(file);
+  std::ofstream     out       = open(temporary);
+  if (!out) {
+    return false;
+  }
+  const std::uint64_t header[] = {MAGIC, VERSION, key.size(), sizeof...(Arrays)};
+  out.write(reinterpret_cast<const char *>(header), sizeof(header));
+  out.write(key.data(), key.size());
+  (writeArray(out, arrays), ...);
+  return commit(temporary, file, out);
+}
+
+template <typename... Arrays>
+bool OperatorCache::read(const std::string &file, const std::string &key, Arrays &... arrays)
+{
+  std::ifstream in(file, std::ios::binary);
+  if (!in) {
+    return false;
+  }
+  std::uint64_t header[4];
+  in.read(reinterpret_cast<char *>(header), sizeof(header));
+  if (!in || header[0] != MAGIC || header[1] != VERSION || header[2] != key.size() || header[3] != sizeof...(Arrays)) {
+    return false;
+  }
+  std::string storedKey(key.size(), '\0');
+  in.read(storedKey.data(), storedKey.size());
+  if (!in || storedKey != key) {
+    return false;
+  }
+  return (readArray(in, arrays) && ...);
+}
+
+template <typename T>
+void OperatorCache::writeArray(std::ofstream &out, const std::vector<T> &array)
+{
+  static_assert(std::is_trivially_copyable_v<T>, "Only arrays of trivially copyable types can be cached.");
+  const std::uint64_t header[] = {sizeof(T), array.size()};
+  out.write(reinterpret_cast<const char *>(header), sizeof(header));
+  out.write(reinterpret_cast<const char *>(array.data()), sizeof(T) * array.size());
+}
+
+template <typename T>
+bool OperatorCache::readArray(std::ifstream &in, std::vector<T> &array)
+{
+  static_assert(std::is_trivially_copyable_v<T>, "Only arrays of trivially copyable types can be cached.");
+  std::uint64_t header[2];
+  in.read(reinterpret_cast<char *>(header), sizeof(header));
+  if (!in || header[0] != sizeof(T)) {
+    return false;
+  }
+  array.resize(header[1]);
+  in.read(reinterpret_cast<char *>(array.data()), sizeof(T) * array.size());
+  return static_cast<bool>(in);
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -9,7 +9,6 @@
 #include "mapping/impl/BasisFunctions.hpp"
 #include "mesh/Filter.hpp"
 #include "precice/impl/Types.hpp"
-#include "profiling/Event.hpp"
 
 namespace precice {
 
@@ -47,6 +46,7 @@ public:
    * @param[in] radius Spatial radius of the cluster associated to the \p center
    * @param[in] function Radial basis function type used in interpolation
    * @param[in] polynomial The polynomial treatment in the RBF system.
+   * @param[in] greedyTolerance Tolerance of the greedy center selection in the RBF system, 0 disables the selection
    * @param[in] inputMesh mesh where the interpolants are build on, i.e., the input mesh for consistent
    *                      mappings and the output mesh for conservative mappings
    * @param[in] outputMesh mesh where we evaluate the interpolants, i.e., the output mesh consistent
@@ -56,9 +56,18 @@ public:
                          double                  radius,
                          RADIAL_BASIS_FUNCTION_T function,
                          Polynomial              polynomial,
+                         double                  greedyTolerance,
                          mesh::PtrMesh           inputMesh,
                          mesh::PtrMesh           outputMesh);
 
+  /**
+   * @brief Builds the vertex grids serving the fixed-radius queries of clusters with the given radii
+   *
+   * Clusters are constructed concurrently, whose queries would otherwise wait for each other to build the grids,
+   * see query::Index::buildVertexGrids(). The meshes are passed as in the constructor.
+   */
+  static void buildVertexGrids(const RADIAL_BASIS_FUNCTION_T &function, const std::vector<double> &radii, mesh::PtrMesh inputMesh, mesh::PtrMesh outputMesh);
+
   /// Evaluates a conservative mapping and agglomerates the result in the given output data
   void mapConservative(const time::Sample &inData, Eigen::VectorXd &outData) const;
 
@@ -77,6 +86,9 @@ public:
   /// The center coordinate of this cluster
   std::array<double, 3> getCenterCoords() const;
 
+  /// The radius of this cluster
+  double getRadius() const;
+
   /// Invalidates and erases data structures the cluster holds
   void clear();
 
@@ -88,6 +100,9 @@ private:
   /// logger, as usual
   precice::logging::Logger _log{"mapping::SphericalVertexCluster"};
 
+  /// Safety margin subtracted from the radius to exclude the output vertices at the edge
+  static constexpr double outputMargin = math::NUMERICAL_ZERO_DIFFERENCE;
+
   /// center vertex of the cluster
   mesh::Vertex _center;
 
@@ -130,18 +145,19 @@ SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::SphericalVertexCluster(
     double                  radius,
     RADIAL_BASIS_FUNCTION_T function,
     Polynomial              polynomial,
+    double                  greedyTolerance,
     mesh::PtrMesh           inputMesh,
     mesh::PtrMesh           outputMesh)
     : _center(center), _radius(radius), _polynomial(polynomial), _weightingFunction(radius)
 {
   PRECICE_TRACE(_center.getCoords(), _radius);
-  precice::profiling::Event eq("map.pou.computeMapping.queryVertices");
+  // Clusters are constructed concurrently, hence, no profiling events are recorded here (see PartitionOfUnityMapping::computeMapping)
   // Disable integrated polynomial, as it might cause locally singular matrices
   PRECICE_ASSERT(_polynomial != Polynomial::ON, "Integrated polynomial is not supported for partition of unity data mappings.");
 
   // Get vertices to be mapped
   // Subtract a safety margin to exclude the vertices at the edge
-  auto outIDs = outputMesh->index().getVerticesInsideBox(center, radius - math::NUMERICAL_ZERO_DIFFERENCE);
+  auto outIDs = outputMesh->index().getVerticesInsideBox(center, radius - outputMargin);
   // Constructing the partition when we don't have evaluation points is pointless
   auto inIDs = inputMesh->index().getVerticesInsideBox(center, radius);
 
@@ -149,7 +165,6 @@ SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::SphericalVertexCluster(
   // The IDs are sorted in the boost flat_set, hence, the function here has N log(N) complexity
   _inputIDs.insert(inIDs.begin(), inIDs.end());
   _outputIDs.insert(outIDs.begin(), outIDs.end());
-  eq.stop();
   // If the cluster is empty, we return immediately
   if (empty()) {
     return;
@@ -164,10 +179,28 @@ SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::SphericalVertexCluster(
 
   // Construct the solver. Here, the constructor of the RadialBasisFctSolver computes already the decompositions etc, such that we can mark the
   // mapping in this cluster as computed (mostly for debugging purpose)
-  std::vector<bool>         deadAxis(inputMesh->getDimensions(), false);
-  precice::profiling::Event e("map.pou.computeMapping.rbfSolver");
-  _rbfSolver          = RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>{function, *inputMesh.get(), _inputIDs, *outputMesh.get(), _outputIDs, deadAxis, _polynomial};
+  std::vector<bool> deadAxis(inputMesh->getDimensions(), false);
+  _rbfSolver          = RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T>{function, *inputMesh.get(), _inputIDs, *outputMesh.get(), _outputIDs, deadAxis, _polynomial,
+                                                                       FactorizationPrecision::DOUBLE, 0., false, 1, greedyTolerance};
   _hasComputedMapping = true;
+
+  // Allocate the weights here, as they are set concurrently for different vertices
+  _normalizedWeights.resize(_outputIDs.size());
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::buildVertexGrids(const RADIAL_BASIS_FUNCTION_T &function, const std::vector<double> &radii, mesh::PtrMesh inputMesh, mesh::PtrMesh outputMesh)
+{
+  std::vector<double> inputRadii = radii;
+  // The sparse assembly of the RBF solver queries the support radius
+  if constexpr (RADIAL_BASIS_FUNCTION_T::hasCompactSupport()) {
+    inputRadii.push_back(function.getSupportRadius());
+  }
+  inputMesh->index().buildVertexGrids(inputRadii);
+
+  std::vector<double> outputRadii(radii.size());
+  std::transform(radii.begin(), radii.end(), outputRadii.begin(), [](double radius) { return radius - outputMargin; });
+  outputMesh->index().buildVertexGrids(outputRadii);
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
@@ -177,9 +210,6 @@ void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::setNormalizedWeight(double
   PRECICE_ASSERT(_outputIDs.contains(id), id);
   PRECICE_ASSERT(normalizedWeight > 0);
 
-  if (_normalizedWeights.size() == 0)
-    _normalizedWeights.resize(_outputIDs.size());
-
   // The find method of boost flat_set comes with O(log(N)) complexity (the more expensive part here)
   auto localID = _outputIDs.index_of(_outputIDs.find(id));
 
@@ -200,29 +230,31 @@ void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::mapConservative(const time
   const auto &       localInData = inData.values;
 
   // TODO: We can probably reduce the temporary allocations here
-  Eigen::VectorXd in(_rbfSolver.getOutputSize());
-
-  // Now we perform the data mapping component-wise
-  for (unsigned int c = 0; c < nComponents; ++c) {
-    // Step 1: extract the relevant input data from the global input data and store
-    // it in a contiguous array, which is required for the RBF solver
-    for (unsigned int i = 0; i < _outputIDs.size(); ++i) {
-      const auto dataIndex = *(_outputIDs.nth(i));
+  // Every data component is one column, such that all components are mapped in a single batched solve
+  Eigen::MatrixXd in(_rbfSolver.getOutputSize(), nComponents);
+
+  // Step 1: extract the relevant input data from the global input data and store
+  // it in a contiguous array, which is required for the RBF solver
+  for (unsigned int i = 0; i < _outputIDs.size(); ++i) {
+    const auto dataIndex = *(_outputIDs.nth(i));
+    PRECICE_ASSERT(_normalizedWeights[i] > 0, _normalizedWeights[i], i);
+    for (unsigned int c = 0; c < nComponents; ++c) {
       PRECICE_ASSERT(dataIndex * nComponents + c < localInData.size(), dataIndex * nComponents + c, localInData.size());
-      PRECICE_ASSERT(_normalizedWeights[i] > 0, _normalizedWeights[i], i);
       // here, we also directly apply the weighting, i.e., we split the input data
-      in[i] = localInData[dataIndex * nComponents + c] * _normalizedWeights[i];
+      in(i, c) = localInData[dataIndex * nComponents + c] * _normalizedWeights[i];
     }
+  }
 
-    // Step 2: solve the system using a conservative constraint
-    auto result = _rbfSolver.solveConservative(in, _polynomial);
-    PRECICE_ASSERT(result.size() == static_cast<Eigen::Index>(_inputIDs.size()));
+  // Step 2: solve the system using a conservative constraint
+  Eigen::MatrixXd result = _rbfSolver.solveConservative(in, _polynomial);
+  PRECICE_ASSERT(result.rows() == static_cast<Eigen::Index>(_inputIDs.size()));
 
-    // Step 3: now accumulate the result into our global output data
-    for (unsigned int i = 0; i < _inputIDs.size(); ++i) {
-      const auto dataIndex = *(_inputIDs.nth(i));
+  // Step 3: now accumulate the result into our global output data
+  for (unsigned int i = 0; i < _inputIDs.size(); ++i) {
+    const auto dataIndex = *(_inputIDs.nth(i));
+    for (unsigned int c = 0; c < nComponents; ++c) {
       PRECICE_ASSERT(dataIndex * nComponents + c < outData.size(), dataIndex * nComponents + c, outData.size());
-      outData[dataIndex * nComponents + c] += result(i);
+      outData[dataIndex * nComponents + c] += result(i, c);
     }
   }
 }
@@ -239,29 +271,31 @@ void SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::mapConsistent(const time::
   const unsigned int nComponents = inData.dataDims;
   const auto &       localInData = inData.values;
 
-  Eigen::VectorXd in(_rbfSolver.getInputSize());
+  // Every data component is one column, such that all components are mapped in a single batched solve
+  Eigen::MatrixXd in = Eigen::MatrixXd::Zero(_rbfSolver.getInputSize(), nComponents);
 
-  // Now we perform the data mapping component-wise
-  for (unsigned int c = 0; c < nComponents; ++c) {
-    // Step 1: extract the relevant input data from the global input data and store
-    // it in a contiguous array, which is required for the RBF solver (last polyparams entries remain zero)
-    for (unsigned int i = 0; i < _inputIDs.size(); i++) {
-      const auto dataIndex = *(_inputIDs.nth(i));
+  // Step 1: extract the relevant input data from the global input data and store
+  // it in a contiguous array, which is required for the RBF solver (last polyparams entries remain zero)
+  for (unsigned int i = 0; i < _inputIDs.size(); i++) {
+    const auto dataIndex = *(_inputIDs.nth(i));
+    for (unsigned int c = 0; c < nComponents; ++c) {
       PRECICE_ASSERT(dataIndex * nComponents + c < localInData.size(), dataIndex * nComponents + c, localInData.size());
-      in[i] = localInData[dataIndex * nComponents + c];
+      in(i, c) = localInData[dataIndex * nComponents + c];
     }
+  }
 
-    // Step 2: solve the system using a consistent constraint
-    auto result = _rbfSolver.solveConsistent(in, _polynomial);
-    PRECICE_ASSERT(static_cast<Eigen::Index>(_outputIDs.size()) == result.size());
+  // Step 2: solve the system using a consistent constraint
+  Eigen::MatrixXd result = _rbfSolver.solveConsistent(in, _polynomial);
+  PRECICE_ASSERT(static_cast<Eigen::Index>(_outputIDs.size()) == result.rows());
 
-    // Step 3: now accumulate the result into our global output data
-    for (unsigned int i = 0; i < _outputIDs.size(); ++i) {
-      const auto dataIndex = *(_outputIDs.nth(i));
+  // Step 3: now accumulate the result into our global output data
+  for (unsigned int i = 0; i < _outputIDs.size(); ++i) {
+    const auto dataIndex = *(_outputIDs.nth(i));
+    PRECICE_ASSERT(_normalizedWeights[i] > 0);
+    for (unsigned int c = 0; c < nComponents; ++c) {
       PRECICE_ASSERT(dataIndex * nComponents + c < outData.size(), dataIndex * nComponents + c, outData.size());
-      PRECICE_ASSERT(_normalizedWeights[i] > 0);
       // here, we also directly apply the weighting, i.e., split the result data
-      outData[dataIndex * nComponents + c] += result(i) * _normalizedWeights[i];
+      outData[dataIndex * nComponents + c] += result(i, c) * _normalizedWeights[i];
     }
   }
 }
@@ -287,6 +321,12 @@ std::array<double, 3> SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::getCenter
   return _center.rawCoords();
 }
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+double SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::getRadius() const
+{
+  return _radius;
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 bool SphericalVertexCluster<RADIAL_BASIS_FUNCTION_T>::empty() const
 {
@@ -0,0 +1,153 @@
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+#include <cmath>
+#include <memory>
+#include "mapping/impl/HierarchicalMatrix.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+using namespace precice::mapping::impl;
+
+namespace {
+/// Perturbed regular grid in the unit square, shifted by the given offset
+Eigen::Matrix3Xd createPoints(int n, double offset)
+{
+  Eigen::Matrix3Xd points(3, n * n);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      const double perturbation = 0.3 * std::sin(7. * i + 3. * j);
+      points.col(i * n + j) << (i + perturbation + offset) / n, (j - perturbation + offset) / n, 0.;
+    }
+  }
+  return points;
+}
+
+/// Exponential kernel, which yields symmetric positive definite matrices
+BlockEvaluator exponentialKernel(const ClusterTree &rowTree, const ClusterTree &colTree)
+{
+  return [&rowTree, &colTree](Eigen::Index rowBegin, Eigen::Index colBegin, Eigen::MatrixXd &block) {
+    for (Eigen::Index j = 0; j < block.cols(); ++j) {
+      for (Eigen::Index i = 0; i < block.rows(); ++i) {
+        block(i, j) = std::exp(-5. * (rowTree.coordinates().col(rowBegin + i) - colTree.coordinates().col(colBegin + j)).norm());
+      }
+    }
+  };
+}
+
+/// Dense kernel matrix in the original order of the points
+Eigen::MatrixXd denseExponentialKernel(const Eigen::Matrix3Xd &rowPoints, const Eigen::Matrix3Xd &colPoints)
+{
+  Eigen::MatrixXd matrix(rowPoints.cols(), colPoints.cols());
+  for (Eigen::Index j = 0; j < colPoints.cols(); ++j) {
+    for (Eigen::Index i = 0; i < rowPoints.cols(); ++i) {
+      matrix(i, j) = std::exp(-5. * (rowPoints.col(i) - colPoints.col(j)).norm());
+    }
+  }
+  return matrix;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(HierarchicalMatrices)
+
+BOOST_AUTO_TEST_CASE(ClusterTreeStructure)
+{
+  PRECICE_TEST(1_rank);
+  const Eigen::Matrix3Xd points = createPoints(20, 0.);
+  const Eigen::Index     leafSize{16};
+  ClusterTree            tree(points, leafSize);
+
+  BOOST_TEST(tree.size() == points.cols());
+  BOOST_TEST(tree.cluster(ClusterTree::root).begin == 0);
+  BOOST_TEST(tree.cluster(ClusterTree::root).size == points.cols());
+
+  for (int id = 0; id < tree.nClusters(); ++id) {
+    const auto &cluster = tree.cluster(id);
+    // All vertices are within the bounding sphere
+    for (Eigen::Index i = cluster.begin; i < cluster.begin + cluster.size; ++i) {
+      BOOST_TEST((tree.coordinates().col(i) - cluster.center).norm() <= cluster.radius + 1e-12);
+    }
+    if (cluster.isLeaf()) {
+      BOOST_TEST(cluster.size <= leafSize);
+    } else {
+      // The children bisect the cluster
+      const auto &first  = tree.cluster(cluster.children[0]);
+      const auto &second = tree.cluster(cluster.children[1]);
+      BOOST_TEST(first.begin == cluster.begin);
+      BOOST_TEST(second.begin == first.begin + first.size);
+      BOOST_TEST(first.size + second.size == cluster.size);
+      BOOST_TEST(std::abs(first.size - second.size) <= 1);
+    }
+  }
+
+  // The permuted coordinates match the original ones
+  const Eigen::MatrixXd original = points.transpose();
+  BOOST_TEST(testing::equals(tree.permute(original), Eigen::MatrixXd(tree.coordinates().transpose())));
+  BOOST_TEST(testing::equals(tree.unpermute(tree.permute(original)), original));
+}
+
+BOOST_AUTO_TEST_CASE(CrossApproximation)
+{
+  PRECICE_TEST(1_rank);
+  // Two well-separated clusters yield a numerically low-rank block
+  const Eigen::Matrix3Xd rowPoints = createPoints(10, 0.);
+  const Eigen::Matrix3Xd colPoints = createPoints(10, 30.);
+  ClusterTree            rowTree(rowPoints, 100);
+  ClusterTree            colTree(colPoints, 100);
+
+  Eigen::MatrixXd U, V;
+  BOOST_TEST(adaptiveCrossApproximation(exponentialKernel(rowTree, colTree), 0, 100, 0, 100, 1e-10, 50, U, V));
+  BOOST_TEST(U.cols() < 25);
+  BOOST_TEST(U.cols() == V.cols());
+
+  Eigen::MatrixXd dense(100, 100);
+  exponentialKernel(rowTree, colTree)(0, 0, dense);
+  BOOST_TEST((dense - U * V.transpose()).norm() <= 1e-8 * dense.norm());
+
+  // The rank limit is reported
+  BOOST_TEST(!adaptiveCrossApproximation(exponentialKernel(rowTree, colTree), 0, 100, 0, 100, 1e-10, 2, U, V));
+}
+
+BOOST_AUTO_TEST_CASE(HODLRSolve)
+{
+  PRECICE_TEST(1_rank);
+  const Eigen::Matrix3Xd points = createPoints(24, 0.);
+  const auto             tree   = std::make_shared<const ClusterTree>(points, 32);
+  HODLRMatrix            matrix(tree, exponentialKernel(*tree, *tree), 1e-12);
+  BOOST_TEST(matrix.isInvertible());
+  BOOST_TEST(matrix.rows() == points.cols());
+
+  const Eigen::MatrixXd dense = denseExponentialKernel(points, points);
+  Eigen::MatrixXd       rhs(points.cols(), 2);
+  rhs.col(0) = points.row(0).transpose();
+  rhs.col(1) = Eigen::VectorXd::LinSpaced(points.cols(), -1., 1.);
+
+  const Eigen::MatrixXd expected = dense.llt().solve(rhs);
+  BOOST_TEST((matrix.solve(rhs) - expected).norm() <= 1e-8 * expected.norm());
+}
+
+BOOST_AUTO_TEST_CASE(HierarchicalProduct)
+{
+  PRECICE_TEST(1_rank);
+  const Eigen::Matrix3Xd rowPoints = createPoints(32, 0.5);
+  const Eigen::Matrix3Xd colPoints = createPoints(30, 0.);
+  const auto             rowTree   = std::make_shared<const ClusterTree>(rowPoints, 32);
+  const auto             colTree   = std::make_shared<const ClusterTree>(colPoints, 32);
+
+  impl::HierarchicalMatrix matrix(rowTree, colTree, exponentialKernel(*rowTree, *colTree), 1e-10);
+  BOOST_TEST(matrix.rows() == rowPoints.cols());
+  BOOST_TEST(matrix.cols() == colPoints.cols());
+  // Admissible blocks are compressed
+  BOOST_TEST(matrix.storedEntries() < rowPoints.cols() * colPoints.cols());
+
+  const Eigen::MatrixXd dense = denseExponentialKernel(rowPoints, colPoints);
+  const Eigen::MatrixXd x     = Eigen::MatrixXd::Random(colPoints.cols(), 3);
+  const Eigen::MatrixXd y     = Eigen::MatrixXd::Random(rowPoints.cols(), 3);
+  BOOST_TEST((matrix.apply(x) - dense * x).norm() <= 1e-8 * (dense * x).norm());
+  BOOST_TEST((matrix.applyTransposed(y) - dense.transpose() * y).norm() <= 1e-8 * (dense.transpose() * y).norm());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // HierarchicalMatrices
+BOOST_AUTO_TEST_SUITE_END()
@@ -39,6 +39,8 @@ BOOST_AUTO_TEST_CASE(Configuration)
   BOOST_TEST(mappingConfig.mappings().at(1).fromMesh == meshConfig->meshes().at(2));
   BOOST_TEST(mappingConfig.mappings().at(1).toMesh == meshConfig->meshes().at(1));
   BOOST_TEST(mappingConfig.mappings().at(1).direction == MappingConfiguration::READ);
+  BOOST_TEST(mappingConfig.mappings().at(0).mapping->getNumberOfThreads() == 1);
+  BOOST_TEST(mappingConfig.mappings().at(1).mapping->getNumberOfThreads() == 2);
 
   BOOST_TEST(mappingConfig.mappings().at(2).fromMesh == meshConfig->meshes().at(1));
   BOOST_TEST(mappingConfig.mappings().at(2).toMesh == meshConfig->meshes().at(0));
@@ -78,6 +80,11 @@ BOOST_AUTO_TEST_CASE(RBFDirectConfiguration)
     BOOST_TEST(mappingConfig.rbfConfig().deadAxis[1] == false);
     BOOST_TEST(mappingConfig.rbfConfig().deadAxis[2] == true);
     BOOST_TEST(mappingConfig.rbfConfig().solverRtol == 1e-9);
+    bool mixedPrecision = mappingConfig.rbfConfig().precision == FactorizationPrecision::MIXED;
+    BOOST_TEST(mixedPrecision);
+    BOOST_TEST(mappingConfig.rbfConfig().matrixFree);
+    BOOST_TEST(mappingConfig.rbfConfig().nThreads == 2);
+    BOOST_TEST(mappingConfig.rbfConfig().greedyTolerance == 0);
   }
 }
 
@@ -114,6 +121,8 @@ BOOST_AUTO_TEST_CASE(RBFPUMConfiguration)
     BOOST_TEST(mappingConfig.rbfConfig().verticesPerCluster == 10);
     BOOST_TEST(mappingConfig.rbfConfig().relativeOverlap == 0.4);
     BOOST_TEST(mappingConfig.rbfConfig().projectToInput == true);
+    BOOST_TEST(mappingConfig.rbfConfig().nThreads == 4);
+    BOOST_TEST(mappingConfig.rbfConfig().greedyTolerance == 1e-4);
   }
 }
 
@@ -157,5 +157,58 @@ BOOST_AUTO_TEST_CASE(ConsistentGradientNotConstant)
   BOOST_CHECK(equals(expected, outValuesVector));
 }
 
+BOOST_AUTO_TEST_CASE(ConsistentBatch3D)
+{
+  PRECICE_TEST(1_rank)
+  int dimensions = 3;
+  using testing::equals;
+
+  // Create mesh to map from
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, testing::nextMeshID()));
+  inMesh->createVertex(Eigen::Vector3d::Constant(0.0));
+  inMesh->createVertex(Eigen::Vector3d::Constant(1.0));
+
+  // Create mesh to map to
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  outMesh->createVertex(Eigen::Vector3d(1.1, 1.0, 0.9));
+  outMesh->createVertex(Eigen::Vector3d(0.1, 0.2, 0.0));
+  outMesh->createVertex(Eigen::Vector3d(0.0, 0.0, -0.3));
+
+  precice::mapping::NearestNeighborGradientMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+
+  // Vector data of two stamples
+  Eigen::VectorXd inValues0(6), inValues1(6);
+  inValues0 << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+  inValues1 << -1.0, 0.0, 1.0, 2.0, 3.0, 4.0;
+  Eigen::MatrixXd inGradients0 = Eigen::MatrixXd::Zero(dimensions, 6);
+  Eigen::MatrixXd inGradients1 = Eigen::MatrixXd::Zero(dimensions, 6);
+  for (int i = 0; i < 6; ++i) {
+    inGradients0.col(i) << i, 1.0, 0.0;
+    inGradients1.col(i) << 0.0, 0.0, -i;
+  }
+  time::Sample inSample0(2, inValues0, inGradients0);
+  time::Sample inSample1(2, inValues1, inGradients1);
+
+  Eigen::MatrixXd outValues;
+  mapping.mapBatch({&inSample0, &inSample1}, outValues);
+  BOOST_TEST_REQUIRE(outValues.rows() == 6);
+  BOOST_TEST_REQUIRE(outValues.cols() == 2);
+
+  // The batch matches mapping the samples individually
+  for (const auto *sample : {&inSample0, &inSample1}) {
+    Eigen::VectorXd outSingle = Eigen::VectorXd::Zero(6);
+    mapping.map(*sample, outSingle);
+    BOOST_CHECK(equals(outSingle, outValues.col(sample == &inSample0 ? 0 : 1)));
+  }
+
+  Eigen::VectorXd expected0(6), expected1(6);
+  expected0 << 3.0 + 0.1 * 2 + 0.0, 4.0 + 0.1 * 3 + 0.0, 1.0 + 0.1 * 0 + 0.2, 2.0 + 0.1 * 1 + 0.2, 1.0, 2.0;
+  expected1 << 1.0 + 0.1 * 2, 2.0 + 0.1 * 3, -1.0, 0.0, -1.0, 0.0 + 0.3 * 1;
+  BOOST_CHECK(equals(expected0, outValues.col(0)));
+  BOOST_CHECK(equals(expected1, outValues.col(1)));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,10 +1,14 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <filesystem>
 #include <memory>
+#include <string>
 #include <string_view>
+#include <vector>
 #include "logging/LogMacros.hpp"
 #include "mapping/Mapping.hpp"
 #include "mapping/NearestNeighborMapping.hpp"
+#include "mapping/impl/OperatorCache.hpp"
 #include "math/constants.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
@@ -543,5 +547,160 @@ BOOST_AUTO_TEST_CASE(ScaledConsistentVolume3D)
   BOOST_TEST(inValues(3) * scaleFactor == outValues(3));
 }
 
+namespace {
+/// Exposes the cache entry, such that tests can replace the stored operator
+struct CachedNearestNeighborMapping : public precice::mapping::NearestNeighborMapping {
+  using NearestNeighborMapping::NearestNeighborMapping;
+  using Mapping::cacheEntry;
+};
+} // namespace
+
+BOOST_AUTO_TEST_CASE(CachedOperator)
+{
+  PRECICE_TEST(1_rank);
+  int dimensions = 2;
+
+  const auto cacheDirectory = std::filesystem::temp_directory_path() / "precice-nn-operator-cache";
+  std::filesystem::remove_all(cacheDirectory);
+  const auto cacheFiles = [&cacheDirectory]() {
+    std::vector<std::string> files;
+    for (const auto &entry : std::filesystem::directory_iterator(cacheDirectory)) {
+      files.push_back(entry.path().string());
+    }
+    return files;
+  };
+
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, testing::nextMeshID()));
+  inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  Vertex &inVertex1 = inMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  outMesh->createVertex(Eigen::Vector2d(0.1, 0.0));
+  outMesh->createVertex(Eigen::Vector2d(0.9, 0.0));
+
+  Eigen::VectorXd inValues(2);
+  inValues << 1.0, 2.0;
+  time::Sample    inSample(1, inValues);
+  Eigen::VectorXd outValues = Eigen::VectorXd::Zero(2);
+
+  // The temporary mapping used for tagging isn't stored
+  {
+    precice::mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+    mapping.setCacheDirectory(cacheDirectory.string());
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.tagMeshFirstRound();
+    BOOST_TEST(!std::filesystem::exists(cacheDirectory));
+  }
+
+  // The first computation stores the operator
+  std::string file, key;
+  {
+    CachedNearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+    mapping.setCacheDirectory(cacheDirectory.string());
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inSample, outValues);
+    BOOST_TEST(outValues(0) == 1.0);
+    BOOST_TEST(outValues(1) == 2.0);
+    file = mapping.cacheEntry().file;
+    key  = mapping.cacheEntry().key;
+  }
+  auto files = cacheFiles();
+  BOOST_TEST_REQUIRE(files.size() == 1);
+  BOOST_TEST(files.front() == file);
+
+  // Operators stored for a different key, such as a colliding hash, are recomputed
+  BOOST_TEST_REQUIRE(mapping::impl::OperatorCache::write(file, key + " of another mapping", std::vector<int>{1, 0}));
+  {
+    precice::mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+    mapping.setCacheDirectory(cacheDirectory.string());
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inSample, outValues);
+    BOOST_TEST(outValues(0) == 1.0);
+    BOOST_TEST(outValues(1) == 2.0);
+  }
+
+  // Replace the stored operator by one swapping the values to detect that it is loaded
+  BOOST_TEST_REQUIRE(mapping::impl::OperatorCache::write(file, key, std::vector<int>{1, 0}));
+  {
+    precice::mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+    mapping.setCacheDirectory(cacheDirectory.string());
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    BOOST_TEST(mapping.hasComputedMapping());
+    mapping.map(inSample, outValues);
+    BOOST_TEST(outValues(0) == 2.0);
+    BOOST_TEST(outValues(1) == 1.0);
+  }
+
+  // Operators not fitting the meshes are recomputed
+  BOOST_TEST_REQUIRE(mapping::impl::OperatorCache::write(file, key, std::vector<int>{0, 5}));
+  {
+    precice::mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+    mapping.setCacheDirectory(cacheDirectory.string());
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inSample, outValues);
+    BOOST_TEST(outValues(0) == 1.0);
+    BOOST_TEST(outValues(1) == 2.0);
+  }
+
+  // Changing a mesh results in a different cache entry
+  inVertex1.setCoords(Eigen::Vector2d(1.0, 0.1));
+  {
+    precice::mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+    mapping.setCacheDirectory(cacheDirectory.string());
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    mapping.map(inSample, outValues);
+    BOOST_TEST(outValues(0) == 1.0);
+    BOOST_TEST(outValues(1) == 2.0);
+  }
+  BOOST_TEST(cacheFiles().size() == 2);
+
+  std::filesystem::remove_all(cacheDirectory);
+}
+
+BOOST_AUTO_TEST_CASE(BatchMatchesSingleSamples)
+{
+  PRECICE_TEST(1_rank);
+  const int dimensions = 2;
+
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, testing::nextMeshID()));
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  for (int i = 0; i < 6; ++i) {
+    inMesh->createVertex(Eigen::Vector2d(i, 0.5 * i * i));
+  }
+  for (int i = 0; i < 4; ++i) {
+    outMesh->createVertex(Eigen::Vector2d(1.6 * i - 0.3, 0.7 * i * i + 0.2));
+  }
+
+  for (auto constraint : {mapping::Mapping::CONSISTENT, mapping::Mapping::CONSERVATIVE}) {
+    mapping::NearestNeighborMapping mapping(constraint, dimensions);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+
+    // Vector data of three samples
+    const Eigen::Index nIn  = dimensions * inMesh->nVertices();
+    const Eigen::Index nOut = dimensions * outMesh->nVertices();
+    const time::Sample inSample0(dimensions, Eigen::VectorXd::LinSpaced(nIn, 1.0, 12.0));
+    const time::Sample inSample1(dimensions, Eigen::VectorXd::LinSpaced(nIn, -3.0, 2.0));
+    const time::Sample inSample2(dimensions, Eigen::VectorXd::Constant(nIn, 0.5));
+
+    Eigen::MatrixXd outValues;
+    mapping.mapBatch({&inSample0, &inSample1, &inSample2}, outValues);
+    BOOST_TEST_REQUIRE(outValues.rows() == nOut);
+    BOOST_TEST_REQUIRE(outValues.cols() == 3);
+
+    int column = 0;
+    for (const auto *sample : {&inSample0, &inSample1, &inSample2}) {
+      Eigen::VectorXd outSingle = Eigen::VectorXd::Zero(nOut);
+      mapping.map(*sample, outSingle);
+      BOOST_TEST(testing::equals(outSingle, Eigen::VectorXd(outValues.col(column++))));
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,9 +1,15 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
 #include <memory>
 #include <ostream>
+#include <string>
+#include <vector>
 #include "mapping/Mapping.hpp"
 #include "mapping/NearestProjectionMapping.hpp"
+#include "mapping/impl/OperatorCache.hpp"
 #include "math/constants.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
@@ -11,6 +17,7 @@
 #include "mesh/Utils.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "time/Sample.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice::mesh {
@@ -723,5 +730,276 @@ BOOST_AUTO_TEST_CASE(TriangleDistances)
   BOOST_TEST(values(0) == 1.0);
 }
 
+namespace {
+/// Exposes the cache entry, such that tests can replace the stored operator
+struct CachedNearestProjectionMapping : public mapping::NearestProjectionMapping {
+  using NearestProjectionMapping::NearestProjectionMapping;
+  using Mapping::cacheEntry;
+};
+} // namespace
+
+BOOST_AUTO_TEST_CASE(CachedOperator)
+{
+  PRECICE_TEST(1_rank);
+  using namespace mesh;
+  int dimensions = 2;
+
+  const auto cacheDirectory = std::filesystem::temp_directory_path() / "precice-np-operator-cache";
+  std::filesystem::remove_all(cacheDirectory);
+
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, testing::nextMeshID()));
+  Vertex &v1 = inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  Vertex &v2 = inMesh->createVertex(Eigen::Vector2d(1.0, 1.0));
+  inMesh->createEdge(v1, v2);
+
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  outMesh->createVertex(Eigen::Vector2d(0.5, 0.5));
+
+  Eigen::VectorXd inValues(2);
+  inValues << 1.0, 3.0;
+  time::Sample    inSample(1, inValues);
+  Eigen::VectorXd outValues = Eigen::VectorXd::Zero(1);
+
+  // The first computation stores the operator
+  std::string file, key;
+  {
+    CachedNearestProjectionMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+    mapping.setCacheDirectory(cacheDirectory.string());
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    outValues.setZero();
+    mapping.map(inSample, outValues);
+    BOOST_TEST(outValues(0) == 2.0);
+    file = mapping.cacheEntry().file;
+    key  = mapping.cacheEntry().key;
+  }
+  std::vector<std::string> files;
+  for (const auto &entry : std::filesystem::directory_iterator(cacheDirectory)) {
+    files.push_back(entry.path().string());
+  }
+  BOOST_TEST_REQUIRE(files.size() == 1);
+  BOOST_TEST(files.front() == file);
+
+  // Replace the stored operator by one picking the second vertex to detect that it is loaded
+  BOOST_TEST_REQUIRE(mapping::impl::OperatorCache::write(file, key, std::vector<std::size_t>{0, 1}, std::vector<int>{1}, std::vector<double>{1.0}));
+  {
+    mapping::NearestProjectionMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+    mapping.setCacheDirectory(cacheDirectory.string());
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    BOOST_TEST(mapping.hasComputedMapping());
+    outValues.setZero();
+    mapping.map(inSample, outValues);
+    BOOST_TEST(outValues(0) == 3.0);
+  }
+
+  // Operators not fitting the meshes are recomputed
+  BOOST_TEST_REQUIRE(mapping::impl::OperatorCache::write(file, key, std::vector<std::size_t>{0, 1, 2}, std::vector<int>{0, 1}, std::vector<double>{1.0, 1.0}));
+  {
+    mapping::NearestProjectionMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+    mapping.setCacheDirectory(cacheDirectory.string());
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+    outValues.setZero();
+    mapping.map(inSample, outValues);
+    BOOST_TEST(outValues(0) == 2.0);
+  }
+
+  std::filesystem::remove_all(cacheDirectory);
+}
+
+BOOST_AUTO_TEST_CASE(HandBuiltOperatorVectorData)
+{
+  PRECICE_TEST(1_rank);
+  using namespace mesh;
+  int dimensions = 2;
+
+  const auto cacheDirectory = std::filesystem::temp_directory_path() / "precice-np-hand-built-operator";
+  std::filesystem::remove_all(cacheDirectory);
+
+  PtrMesh lineMesh(new Mesh("LineMesh", dimensions, testing::nextMeshID()));
+  Vertex &v0 = lineMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  Vertex &v1 = lineMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+  Vertex &v2 = lineMesh->createVertex(Eigen::Vector2d(2.0, 0.0));
+  lineMesh->createEdge(v0, v1);
+  lineMesh->createEdge(v1, v2);
+
+  PtrMesh pointMesh(new Mesh("PointMesh", dimensions, testing::nextMeshID()));
+  pointMesh->createVertex(Eigen::Vector2d(0.5, 1.0));
+  pointMesh->createVertex(Eigen::Vector2d(1.5, 1.0));
+
+  // A CSR operator with two rows for the points and columns referring to the line vertices
+  const std::vector<std::size_t> offsets{0, 2, 5};
+  const std::vector<int>         columns{0, 2, 2, 1, 0};
+  const std::vector<double>      weights{0.25, 0.75, 0.5, 0.3, 0.2};
+
+  // Computes the mapping once to obtain the cache entry and replaces the stored operator
+  auto setup = [&](mapping::Mapping::Constraint constraint, const PtrMesh &in, const PtrMesh &out) {
+    {
+      CachedNearestProjectionMapping mapping(constraint, dimensions);
+      mapping.setCacheDirectory(cacheDirectory.string());
+      mapping.setMeshes(in, out);
+      mapping.computeMapping();
+      BOOST_TEST_REQUIRE(mapping::impl::OperatorCache::write(mapping.cacheEntry().file, mapping.cacheEntry().key, offsets, columns, weights));
+    }
+    auto mapping = std::make_unique<mapping::NearestProjectionMapping>(constraint, dimensions);
+    mapping->setCacheDirectory(cacheDirectory.string());
+    mapping->setMeshes(in, out);
+    mapping->computeMapping();
+    return mapping;
+  };
+
+  // Maps a sample and the doubled sample in a batch, which has to give the doubled result
+  auto check = [](mapping::Mapping &mapping, const Eigen::VectorXd &inValues, const Eigen::VectorXd &expected) {
+    time::Sample    inSample(2, inValues);
+    Eigen::VectorXd outValues = Eigen::VectorXd::Zero(expected.size());
+    mapping.map(inSample, outValues);
+    BOOST_TEST(testing::equals(outValues, expected));
+
+    time::Sample                      doubled(2, 2.0 * inValues);
+    std::vector<const time::Sample *> inData{&inSample, &doubled};
+    Eigen::MatrixXd                   outData = Eigen::MatrixXd::Zero(expected.size(), 2);
+    mapping.mapBatch(inData, outData);
+    BOOST_TEST(testing::equals(Eigen::VectorXd(outData.col(0)), expected));
+    BOOST_TEST(testing::equals(Eigen::VectorXd(outData.col(1)), Eigen::VectorXd(2.0 * expected)));
+  };
+
+  // Consistent: the points gather linear combinations of the line vertices
+  {
+    auto            mapping = setup(mapping::Mapping::CONSISTENT, lineMesh, pointMesh);
+    Eigen::VectorXd inValues(6);
+    inValues << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+    Eigen::VectorXd expected(4);
+    expected << 4.0, 5.0, 3.6, 4.6;
+    check(*mapping, inValues, expected);
+  }
+
+  // Conservative: the points distribute their values among the line vertices
+  {
+    auto            mapping = setup(mapping::Mapping::CONSERVATIVE, pointMesh, lineMesh);
+    Eigen::VectorXd inValues(4);
+    inValues << 1.0, 2.0, 3.0, 4.0;
+    Eigen::VectorXd expected(6);
+    expected << 0.85, 1.3, 0.9, 1.2, 2.25, 3.5;
+    check(*mapping, inValues, expected);
+  }
+
+  std::filesystem::remove_all(cacheDirectory);
+}
+
+BOOST_AUTO_TEST_CASE(ConcurrentOperatorMatchesQueries)
+{
+  PRECICE_TEST(1_rank);
+  using namespace mesh;
+  int dimensions = 3;
+
+  // A triangulated unit square and a detached edge and vertex, leading to polations of all sizes
+  PtrMesh   inMesh(new Mesh("InMesh", dimensions, testing::nextMeshID()));
+  const int n = 20;
+  for (int j = 0; j <= n; ++j) {
+    for (int i = 0; i <= n; ++i) {
+      inMesh->createVertex(Eigen::Vector3d(i / double(n), j / double(n), 0.0));
+    }
+  }
+  auto vertex = [&](int i, int j) -> Vertex & { return inMesh->vertex(j * (n + 1) + i); };
+  for (int j = 0; j < n; ++j) {
+    for (int i = 0; i < n; ++i) {
+      auto &e0 = inMesh->createEdge(vertex(i, j), vertex(i + 1, j));
+      auto &e1 = inMesh->createEdge(vertex(i + 1, j), vertex(i + 1, j + 1));
+      auto &e2 = inMesh->createEdge(vertex(i, j), vertex(i + 1, j + 1));
+      auto &e3 = inMesh->createEdge(vertex(i, j + 1), vertex(i + 1, j + 1));
+      auto &e4 = inMesh->createEdge(vertex(i, j), vertex(i, j + 1));
+      inMesh->createTriangle(e0, e1, e2);
+      inMesh->createTriangle(e2, e3, e4);
+    }
+  }
+  Vertex &a = inMesh->createVertex(Eigen::Vector3d(3.0, 0.0, 0.0));
+  Vertex &b = inMesh->createVertex(Eigen::Vector3d(3.0, 1.0, 0.0));
+  inMesh->createEdge(a, b);
+  inMesh->createVertex(Eigen::Vector3d(-3.0, -3.0, 0.0));
+
+  Eigen::VectorXd inValues(inMesh->nVertices());
+  for (const auto &v : inMesh->vertices()) {
+    inValues(v.getID()) = 1.0 + 2.0 * v.coord(0) + 3.0 * v.coord(1);
+  }
+
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  // Enough vertices to split the queries among the threads
+  const int m = 3000;
+  for (int k = 0; k < m; ++k) {
+    // Deterministic scattered points around the square, the edge and the vertex
+    const double x = 7.0 * std::fmod(k * 0.6180339887, 1.0) - 3.5;
+    const double y = 5.0 * std::fmod(k * 0.4142135623, 1.0) - 3.5;
+    outMesh->createVertex(Eigen::Vector3d(x, y, 0.1 * std::fmod(k * 0.7320508075, 1.0)));
+  }
+
+  mapping::NearestProjectionMapping mapping(mapping::Mapping::CONSISTENT, dimensions);
+  mapping.setNumberOfThreads(3);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  time::Sample    inSample(1, inValues);
+  Eigen::VectorXd outValues = Eigen::VectorXd::Zero(m);
+  mapping.map(inSample, outValues);
+
+  std::vector<int> sizes(5, 0);
+  for (const auto &v : outMesh->vertices()) {
+    const auto polation = inMesh->index().findNearestProjection(v.getCoords(), 4).polation;
+    double     expected = 0.0;
+    for (const auto &elem : polation.getWeightedElements()) {
+      expected += elem.weight * inValues(elem.vertexID);
+    }
+    sizes.at(polation.getWeightedElements().size())++;
+    BOOST_TEST(outValues(v.getID()) == expected, boost::test_tools::tolerance(1e-12));
+  }
+  BOOST_TEST(sizes[1] > 0);
+  BOOST_TEST(sizes[2] > 0);
+  BOOST_TEST(sizes[3] > 0);
+}
+
+BOOST_AUTO_TEST_CASE(BatchMatchesSingleSamples)
+{
+  PRECICE_TEST(1_rank);
+  using namespace mesh;
+  const int dimensions = 2;
+
+  // A polyline, such that output vertices project onto edges and vertices
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, testing::nextMeshID()));
+  Vertex *previous = &inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  for (int i = 1; i < 5; ++i) {
+    Vertex &next = inMesh->createVertex(Eigen::Vector2d(i, (i % 2) * 0.5));
+    inMesh->createEdge(*previous, next);
+    previous = &next;
+  }
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  for (int i = 0; i < 6; ++i) {
+    outMesh->createVertex(Eigen::Vector2d(0.8 * i - 0.2, 0.6));
+  }
+
+  for (auto constraint : {mapping::Mapping::CONSISTENT, mapping::Mapping::CONSERVATIVE}) {
+    mapping::NearestProjectionMapping mapping(constraint, dimensions);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.computeMapping();
+
+    // Vector data of three samples
+    const Eigen::Index nIn  = dimensions * inMesh->nVertices();
+    const Eigen::Index nOut = dimensions * outMesh->nVertices();
+    const time::Sample inSample0(dimensions, Eigen::VectorXd::LinSpaced(nIn, 1.0, 12.0));
+    const time::Sample inSample1(dimensions, Eigen::VectorXd::LinSpaced(nIn, -3.0, 2.0));
+    const time::Sample inSample2(dimensions, Eigen::VectorXd::Constant(nIn, 0.5));
+
+    Eigen::MatrixXd outValues;
+    mapping.mapBatch({&inSample0, &inSample1, &inSample2}, outValues);
+    BOOST_TEST_REQUIRE(outValues.rows() == nOut);
+    BOOST_TEST_REQUIRE(outValues.cols() == 3);
+
+    int column = 0;
+    for (const auto *sample : {&inSample0, &inSample1, &inSample2}) {
+      Eigen::VectorXd outSingle = Eigen::VectorXd::Zero(nOut);
+      mapping.map(*sample, outSingle);
+      BOOST_TEST(testing::equals(outSingle, Eigen::VectorXd(outValues.col(column++))));
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -94,6 +94,64 @@ BOOST_AUTO_TEST_CASE(createClustering3D)
   }
 }
 
+BOOST_AUTO_TEST_CASE(balanceClustering2D)
+{
+  PRECICE_TEST(1_rank);
+
+  int meshDimension = 2;
+  // Generate the meshes
+  mesh::PtrMesh inMesh  = std::make_shared<Mesh>("inMesh", meshDimension, testing::nextMeshID());
+  mesh::PtrMesh outMesh = std::make_shared<Mesh>("outMesh", meshDimension, testing::nextMeshID());
+
+  // Create matching meshes with a refined corner, which has a ten times higher point density
+  for (unsigned int i = 0; i < 40; ++i) {
+    for (unsigned int j = 0; j < 40; ++j) {
+      if (i >= 10 || j >= 10) {
+        inMesh->createVertex(Eigen::Vector2d(static_cast<double>(i), static_cast<double>(j)));
+        outMesh->createVertex(Eigen::Vector2d(static_cast<double>(i), static_cast<double>(j)));
+      }
+    }
+  }
+  for (unsigned int i = 0; i < 100; ++i) {
+    for (unsigned int j = 0; j < 100; ++j) {
+      inMesh->createVertex(Eigen::Vector2d(0.1 * i, 0.1 * j));
+      outMesh->createVertex(Eigen::Vector2d(0.1 * i, 0.1 * j));
+    }
+  }
+  double       relativeOverlap      = 0.15;
+  unsigned int verticesPerPartition = 50;
+  bool         projectToInput       = false;
+
+  auto [clusterRadius, centers] = impl::createClustering(inMesh, outMesh, relativeOverlap, verticesPerPartition, projectToInput);
+  const auto clusterSize        = [&](const mesh::Vertex &center, double radius) { return inMesh->index().getVerticesInsideBox(center, radius).size(); };
+  std::size_t maxSize            = 0;
+  for (const auto &center : centers) {
+    maxSize = std::max(maxSize, clusterSize(center, clusterRadius));
+  }
+
+  const auto radii = impl::balanceClustering(centers, clusterRadius, inMesh, outMesh, relativeOverlap, verticesPerPartition, projectToInput);
+  BOOST_TEST(radii.size() == centers.size());
+
+  // The size of the largest cluster decreases and all clusters are non-empty
+  std::size_t balancedMaxSize = 0;
+  for (std::size_t i = 0; i < centers.size(); ++i) {
+    BOOST_TEST(centers[i].getID() == static_cast<int>(i));
+    BOOST_TEST(radii[i] > 0);
+    BOOST_TEST(clusterSize(centers[i], radii[i]) > 0);
+    balancedMaxSize = std::max(balancedMaxSize, clusterSize(centers[i], radii[i]));
+  }
+  // Splits at the transition of the point densities are rejected by the cost model, if the split doesn't pay off
+  BOOST_TEST(maxSize > 10 * verticesPerPartition);
+  BOOST_TEST(balancedMaxSize <= 2 * verticesPerPartition);
+
+  // All output vertices remain covered by the clusters
+  for (const auto &vertex : outMesh->vertices()) {
+    BOOST_TEST(std::any_of(centers.begin(), centers.end(), [&, &radii = radii](const auto &center) {
+      return (center.getCoords() - vertex.getCoords()).norm() < radii[center.getID()] - math::NUMERICAL_ZERO_DIFFERENCE;
+    }));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Serial
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,5 +1,6 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <cmath>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -7,6 +8,7 @@
 #include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/OperatorRegistry.hpp"
 #include "mapping/PartitionOfUnityMapping.hpp"
 #include "mapping/impl/BasisFunctions.hpp"
 #include "mesh/Data.hpp"
@@ -1138,6 +1140,11 @@ BOOST_AUTO_TEST_CASE(PartitionOfUnityMappingTests)
   perform3DTestConservativeMapping(conservativeMap3D);
   mapping::PartitionOfUnityMapping<CompactPolynomialC0> conservativeMap3DVector(Mapping::CONSERVATIVE, 3, function, Polynomial::SEPARATE, 5, 0.265, false);
   perform3DTestConservativeMappingVector(conservativeMap3DVector);
+  // The balancing of the clusters is optional
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> balancedMap2D(Mapping::CONSISTENT, 2, function, Polynomial::SEPARATE, 5, 0.4, false, 1, 0., true);
+  perform2DTestConsistentMapping(balancedMap2D);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC0> balancedMap3D(Mapping::CONSERVATIVE, 3, function, Polynomial::SEPARATE, 5, 0.265, false, 1, 0., true);
+  perform3DTestConservativeMapping(balancedMap3D);
 }
 
 // Test for small meshes, where the number of requested vertices per cluster is bigger than the global
@@ -1264,6 +1271,172 @@ BOOST_AUTO_TEST_CASE(TestSingleClusterPartitionOfUnity)
   BOOST_TEST(value < 1.4);
 }
 
+// Compares the threaded cluster computation and evaluation against the serial one
+void performThreadedMapping(Mapping::Constraint constraint)
+{
+  const int dimensions = 2;
+  using Eigen::Vector2d;
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData inData = inMesh->createData("InData", 1, 0_dataID);
+  for (int i = 0; i < 40; ++i) {
+    for (int j = 0; j < 40; ++j) {
+      inMesh->createVertex(Vector2d(i * 0.1, j * 0.1));
+    }
+  }
+  inMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()(v.getID()) = std::sin(v.coord(0)) + v.coord(1);
+  }
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData outData = outMesh->createData("OutData", 1, 1_dataID);
+  for (int i = 0; i < 50; ++i) {
+    for (int j = 0; j < 50; ++j) {
+      outMesh->createVertex(Vector2d(0.01 + i * 0.077, 0.02 + j * 0.077));
+    }
+  }
+  outMesh->allocateDataValues();
+  addGlobalIndex(outMesh);
+
+  auto map = [&](unsigned int nThreads) {
+    mapping::PartitionOfUnityMapping<CompactPolynomialC2> mapping(constraint, dimensions, mapping::CompactPolynomialC2(0.5), Polynomial::SEPARATE, 10, 0.3, false, nThreads);
+    if (constraint == Mapping::CONSERVATIVE) {
+      mapping.setMeshes(outMesh, inMesh);
+    } else {
+      mapping.setMeshes(inMesh, outMesh);
+    }
+    mapping.computeMapping();
+    time::Sample    in{1, constraint == Mapping::CONSERVATIVE ? Eigen::VectorXd(Eigen::VectorXd::Ones(outMesh->nVertices())) : inData->values()};
+    Eigen::VectorXd out = Eigen::VectorXd::Zero(constraint == Mapping::CONSERVATIVE ? inMesh->nVertices() : outMesh->nVertices());
+    mapping.map(in, out);
+    return out;
+  };
+
+  const Eigen::VectorXd serial   = map(1);
+  const Eigen::VectorXd threaded = map(4);
+  BOOST_TEST(serial.norm() > 0);
+  BOOST_TEST(equals(serial, threaded, 1e-10));
+}
+
+BOOST_AUTO_TEST_CASE(ThreadedConsistent)
+{
+  PRECICE_TEST(1_rank);
+  performThreadedMapping(Mapping::CONSISTENT);
+}
+
+BOOST_AUTO_TEST_CASE(ThreadedConservative)
+{
+  PRECICE_TEST(1_rank);
+  performThreadedMapping(Mapping::CONSERVATIVE);
+}
+
+BOOST_AUTO_TEST_CASE(SharedClusters)
+{
+  PRECICE_TEST(1_rank);
+  using Mapping = mapping::PartitionOfUnityMapping<CompactPolynomialC2>;
+  auto create   = [](Mapping::Constraint constraint) {
+    return std::make_unique<Mapping>(constraint, 2, CompactPolynomialC2(3.), Polynomial::SEPARATE, 10, 0.3, false);
+  };
+
+  PtrMesh meshA(new Mesh("MeshA", 2, testing::nextMeshID()));
+  PtrMesh meshB(new Mesh("MeshB", 2, testing::nextMeshID()));
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      meshA->createVertex(Eigen::Vector2d(i, j));
+      meshB->createVertex(Eigen::Vector2d(i * 0.9 + 0.3, j * 0.95 + 0.2));
+    }
+  }
+
+  // A consistent mapping from A to B and a conservative mapping from B to A use the same clusters
+  auto registry     = std::make_shared<OperatorRegistry>();
+  auto consistent   = create(Mapping::CONSISTENT);
+  auto conservative = create(Mapping::CONSERVATIVE);
+  auto reference    = create(Mapping::CONSERVATIVE);
+  consistent->setMeshes(meshA, meshB);
+  conservative->setMeshes(meshB, meshA);
+  reference->setMeshes(meshB, meshA);
+  consistent->setOperatorRegistry(registry, "A-B");
+  conservative->setOperatorRegistry(registry, "A-B");
+
+  consistent->computeMapping();
+  conservative->computeMapping();
+  reference->computeMapping();
+
+  const Eigen::VectorXd inValues = Eigen::VectorXd::LinSpaced(meshB->nVertices(), -1.0, 3.0);
+  time::Sample          inSample(1, inValues);
+  Eigen::VectorXd       outValues    = Eigen::VectorXd::Zero(meshA->nVertices());
+  Eigen::VectorXd       outReference = Eigen::VectorXd::Zero(meshA->nVertices());
+  conservative->map(inSample, outValues);
+  reference->map(inSample, outReference);
+  BOOST_TEST(testing::equals(outValues, outReference, 1e-12));
+
+  // The consistent mapping still works on the shared clusters after the conservative one is cleared
+  conservative->clear();
+  const Eigen::VectorXd inValuesA    = Eigen::VectorXd::LinSpaced(meshA->nVertices(), 0.0, 1.0);
+  time::Sample          inSampleA(1, inValuesA);
+  Eigen::VectorXd       outValuesB = Eigen::VectorXd::Zero(meshB->nVertices());
+  consistent->map(inSampleA, outValuesB);
+  BOOST_TEST(outValuesB.minCoeff() >= -0.1);
+  BOOST_TEST(outValuesB.maxCoeff() <= 1.1);
+}
+
+BOOST_AUTO_TEST_CASE(SharedClustersOfDifferentMeshes)
+{
+  PRECICE_TEST(1_rank);
+  using Mapping = mapping::PartitionOfUnityMapping<CompactPolynomialC2>;
+  auto create   = [](Mapping::Constraint constraint) {
+    return std::make_unique<Mapping>(constraint, 2, CompactPolynomialC2(3.), Polynomial::SEPARATE, 10, 0.3, false);
+  };
+
+  PtrMesh meshA(new Mesh("MeshA", 2, testing::nextMeshID()));
+  PtrMesh meshB(new Mesh("MeshB", 2, testing::nextMeshID()));
+  for (int i = 0; i < 10; ++i) {
+    for (int j = 0; j < 10; ++j) {
+      meshA->createVertex(Eigen::Vector2d(i, j));
+      meshB->createVertex(Eigen::Vector2d(i * 0.9 + 0.3, j * 0.95 + 0.2));
+    }
+  }
+  // The conservative mapping sees a coarser version of mesh A, e.g., filtered differently
+  PtrMesh coarseA(new Mesh("CoarseMeshA", 2, testing::nextMeshID()));
+  for (int i = 0; i < 10; i += 2) {
+    for (int j = 0; j < 10; ++j) {
+      coarseA->createVertex(Eigen::Vector2d(i, j));
+    }
+  }
+
+  // Both mappings are registered as equivalent, but the conservative one has to compute its own clusters
+  auto registry     = std::make_shared<OperatorRegistry>();
+  auto consistent   = create(Mapping::CONSISTENT);
+  auto conservative = create(Mapping::CONSERVATIVE);
+  auto reference    = create(Mapping::CONSERVATIVE);
+  consistent->setMeshes(meshA, meshB);
+  conservative->setMeshes(meshB, coarseA);
+  reference->setMeshes(meshB, coarseA);
+  consistent->setOperatorRegistry(registry, "A-B");
+  conservative->setOperatorRegistry(registry, "A-B");
+
+  consistent->computeMapping();
+  conservative->computeMapping();
+  reference->computeMapping();
+
+  const Eigen::VectorXd inValues = Eigen::VectorXd::LinSpaced(meshB->nVertices(), -1.0, 3.0);
+  time::Sample          inSample(1, inValues);
+  Eigen::VectorXd       outValues    = Eigen::VectorXd::Zero(coarseA->nVertices());
+  Eigen::VectorXd       outReference = Eigen::VectorXd::Zero(coarseA->nVertices());
+  conservative->map(inSample, outValues);
+  reference->map(inSample, outReference);
+  BOOST_TEST(testing::equals(outValues, outReference, 1e-12));
+
+  // The consistent mapping keeps its own clusters
+  const Eigen::VectorXd inValuesA  = Eigen::VectorXd::Constant(meshA->nVertices(), 2.0);
+  time::Sample          inSampleA(1, inValuesA);
+  Eigen::VectorXd       outValuesB = Eigen::VectorXd::Zero(meshB->nVertices());
+  consistent->map(inSampleA, outValuesB);
+  BOOST_TEST(testing::equals(outValuesB, Eigen::VectorXd::Constant(meshB->nVertices(), 2.0), 1e-10));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Serial
 
 BOOST_AUTO_TEST_SUITE(Parallel)
@@ -7,6 +7,7 @@
 #include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/OperatorRegistry.hpp"
 #include "mapping/RadialBasisFctMapping.hpp"
 #include "mapping/RadialBasisFctSolver.hpp"
 #include "mapping/config/MappingConfiguration.hpp"
@@ -19,6 +20,7 @@
 #include "mesh/Vertex.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "time/Sample.hpp"
 
 using namespace precice;
 using namespace precice::mesh;
@@ -1525,6 +1527,311 @@ void testDeadAxis3d(Polynomial polynomial, Mapping::Constraint constraint)
   }
 }
 
+BOOST_AUTO_TEST_CASE(SparseCompactSupport)
+{
+  PRECICE_TEST(1_rank);
+  // Regular grids, such that every vertex has only a few neighbors within the support radius
+  const int    n = 20;
+  const double h = 1.0 / (n - 1);
+  mesh::Mesh   inMesh("InMesh", 2, testing::nextMeshID());
+  mesh::Mesh   outMesh("OutMesh", 2, testing::nextMeshID());
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      inMesh.createVertex(Eigen::Vector2d(i * h, j * h));
+      outMesh.createVertex(Eigen::Vector2d((i + 0.3) * h, (j + 0.6) * h));
+    }
+  }
+  const auto inIDs  = boost::irange<Eigen::Index>(0, inMesh.nVertices());
+  const auto outIDs = boost::irange<Eigen::Index>(0, outMesh.nVertices());
+
+  CompactPolynomialC2                       fct(3 * h);
+  RadialBasisFctSolver<CompactPolynomialC2> solver(fct, inMesh, inIDs, outMesh, outIDs, {false, false}, Polynomial::OFF);
+  BOOST_TEST(solver.isSparse());
+  BOOST_TEST(solver.getInputSize() == n * n);
+  BOOST_TEST(solver.getOutputSize() == n * n);
+
+  // Compare against the dense matrices
+  const std::array<bool, 3> activeAxis{{true, true, false}};
+  const Eigen::MatrixXd     matrixCLU = buildMatrixCLU(fct, inMesh, inIDs, activeAxis, Polynomial::OFF);
+  const Eigen::MatrixXd     matrixA   = buildMatrixA(fct, inMesh, inIDs, outMesh, outIDs, activeAxis, Polynomial::OFF);
+
+  Eigen::VectorXd inValues(n * n);
+  for (const auto &v : inMesh.vertices()) {
+    inValues(v.getID()) = std::sin(v.coord(0)) + 2 * v.coord(1);
+  }
+  const Eigen::VectorXd expectedConsistent = matrixA * matrixCLU.llt().solve(inValues);
+  BOOST_TEST(testing::equals(solver.solveConsistent(inValues, Polynomial::OFF), expectedConsistent, 1e-10));
+
+  const Eigen::VectorXd outValues            = Eigen::VectorXd::LinSpaced(n * n, 0.0, 1.0);
+  const Eigen::VectorXd expectedConservative = matrixCLU.llt().solve(matrixA.transpose() * outValues);
+  BOOST_TEST(testing::equals(solver.solveConservative(outValues, Polynomial::OFF), expectedConservative, 1e-10));
+
+  // Supports covering large parts of the mesh are estimated to be too dense and use the dense matrices
+  BOOST_TEST(estimateFillRatio(3 * h, inMesh, inIDs) < 0.1);
+  BOOST_TEST(estimateFillRatio(0.5, inMesh, inIDs) > 0.1);
+  RadialBasisFctSolver<CompactPolynomialC2> denseSolver(CompactPolynomialC2(0.5), inMesh, inIDs, outMesh, outIDs, {false, false}, Polynomial::OFF);
+  BOOST_TEST(!denseSolver.isSparse());
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void testMixedPrecision(RADIAL_BASIS_FUNCTION_T fct, Polynomial polynomial)
+{
+  const int    n = 10;
+  const double h = 1.0 / (n - 1);
+  mesh::Mesh   inMesh("InMesh", 2, testing::nextMeshID());
+  mesh::Mesh   outMesh("OutMesh", 2, testing::nextMeshID());
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      inMesh.createVertex(Eigen::Vector2d(i * h, j * h));
+      outMesh.createVertex(Eigen::Vector2d((i + 0.3) * h, (j + 0.6) * h));
+    }
+  }
+  const auto inIDs  = boost::irange<Eigen::Index>(0, inMesh.nVertices());
+  const auto outIDs = boost::irange<Eigen::Index>(0, outMesh.nVertices());
+
+  RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T> doubleSolver(fct, inMesh, inIDs, outMesh, outIDs, {false, false}, polynomial);
+  RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T> mixedSolver(fct, inMesh, inIDs, outMesh, outIDs, {false, false}, polynomial, FactorizationPrecision::MIXED);
+  BOOST_TEST(!doubleSolver.isMixedPrecision());
+  BOOST_TEST(mixedSolver.isMixedPrecision());
+  BOOST_TEST(mixedSolver.getInputSize() == doubleSolver.getInputSize());
+  BOOST_TEST(mixedSolver.getOutputSize() == doubleSolver.getOutputSize());
+
+  // The integrated polynomial requires zero-padded data
+  Eigen::MatrixXd inValues = Eigen::MatrixXd::Zero(doubleSolver.getInputSize(), 2);
+  for (const auto &v : inMesh.vertices()) {
+    inValues(v.getID(), 0) = std::sin(v.coord(0)) + 2 * v.coord(1);
+    inValues(v.getID(), 1) = v.coord(0) * v.coord(1);
+  }
+  // Each right-hand side is refined until it converged
+  Eigen::MatrixXd       inValuesCopy = inValues;
+  const Eigen::MatrixXd consistent   = mixedSolver.solveConsistent(inValuesCopy, polynomial);
+  inValuesCopy                       = inValues;
+  BOOST_TEST(testing::equals(consistent, doubleSolver.solveConsistent(inValuesCopy, polynomial), 1e-8));
+
+  const Eigen::VectorXd outValues    = Eigen::VectorXd::LinSpaced(doubleSolver.getOutputSize(), 0.0, 1.0);
+  const Eigen::VectorXd conservative = mixedSolver.solveConservative(outValues, polynomial);
+  BOOST_TEST(testing::equals(conservative, doubleSolver.solveConservative(outValues, polynomial), 1e-8));
+
+  // The conservative mapping remains the adjoint of the consistent mapping
+  if (polynomial != Polynomial::ON) {
+    const double consistentSum = consistent.col(0).dot(outValues);
+    BOOST_TEST(std::abs(consistentSum - inValues.col(0).dot(conservative)) <= 1e-8 * std::abs(consistentSum));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(MixedPrecision)
+{
+  PRECICE_TEST(1_rank);
+  // Uses a single-precision QR decomposition
+  testMixedPrecision(ThinPlateSplines(), Polynomial::ON);
+  testMixedPrecision(ThinPlateSplines(), Polynomial::SEPARATE);
+  // Uses a single-precision Cholesky decomposition, the support radius is large enough to keep the system dense
+  testMixedPrecision(CompactPolynomialC2(0.5), Polynomial::OFF);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void testHierarchicalCompression(RADIAL_BASIS_FUNCTION_T fct, Polynomial polynomial)
+{
+  const int    n = 30;
+  const double h = 1.0 / (n - 1);
+  mesh::Mesh   inMesh("InMesh", 2, testing::nextMeshID());
+  mesh::Mesh   outMesh("OutMesh", 2, testing::nextMeshID());
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      inMesh.createVertex(Eigen::Vector2d(i * h, j * h));
+      outMesh.createVertex(Eigen::Vector2d((i + 0.3) * h, (j + 0.6) * h));
+    }
+  }
+  const auto inIDs  = boost::irange<Eigen::Index>(0, inMesh.nVertices());
+  const auto outIDs = boost::irange<Eigen::Index>(0, outMesh.nVertices());
+
+  RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T> denseSolver(fct, inMesh, inIDs, outMesh, outIDs, {false, false}, polynomial);
+  RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T> hierarchicalSolver(fct, inMesh, inIDs, outMesh, outIDs, {false, false}, polynomial, FactorizationPrecision::DOUBLE, 1e-12);
+  BOOST_TEST(!denseSolver.isHierarchical());
+  BOOST_TEST(hierarchicalSolver.isHierarchical());
+  BOOST_TEST(hierarchicalSolver.getInputSize() == denseSolver.getInputSize());
+  BOOST_TEST(hierarchicalSolver.getOutputSize() == denseSolver.getOutputSize());
+
+  Eigen::VectorXd inValues(n * n);
+  for (const auto &v : inMesh.vertices()) {
+    inValues(v.getID()) = std::sin(3 * v.coord(0)) + 2 * v.coord(1);
+  }
+  Eigen::VectorXd       inValuesCopy       = inValues;
+  const Eigen::VectorXd expectedConsistent = denseSolver.solveConsistent(inValuesCopy, polynomial);
+  BOOST_TEST((hierarchicalSolver.solveConsistent(inValues, polynomial) - expectedConsistent).norm() <= 1e-6 * expectedConsistent.norm());
+
+  const Eigen::VectorXd outValues            = Eigen::VectorXd::LinSpaced(n * n, 0.0, 1.0);
+  const Eigen::VectorXd expectedConservative = denseSolver.solveConservative(outValues, polynomial);
+  BOOST_TEST((hierarchicalSolver.solveConservative(outValues, polynomial) - expectedConservative).norm() <= 1e-6 * expectedConservative.norm());
+}
+
+BOOST_AUTO_TEST_CASE(HierarchicalCompression)
+{
+  PRECICE_TEST(1_rank);
+  testHierarchicalCompression(ThinPlateSplines(), Polynomial::SEPARATE);
+  testHierarchicalCompression(InverseMultiquadrics(0.1), Polynomial::OFF);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void testMatrixFree(RADIAL_BASIS_FUNCTION_T fct, Polynomial polynomial, unsigned int nThreads)
+{
+  // The mesh sizes are no multiples of the tile sizes
+  const int  nIn = 20;
+  const int  nX = 23, nY = 17;
+  mesh::Mesh inMesh("InMesh", 2, testing::nextMeshID());
+  mesh::Mesh outMesh("OutMesh", 2, testing::nextMeshID());
+  for (int i = 0; i < nIn; ++i) {
+    for (int j = 0; j < nIn; ++j) {
+      inMesh.createVertex(Eigen::Vector2d(i / (nIn - 1.), j / (nIn - 1.)));
+    }
+  }
+  for (int i = 0; i < nX; ++i) {
+    for (int j = 0; j < nY; ++j) {
+      outMesh.createVertex(Eigen::Vector2d((i + 0.3) / nX, (j + 0.6) / nY));
+    }
+  }
+  const auto inIDs  = boost::irange<Eigen::Index>(0, inMesh.nVertices());
+  const auto outIDs = boost::irange<Eigen::Index>(0, outMesh.nVertices());
+
+  RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T> denseSolver(fct, inMesh, inIDs, outMesh, outIDs, {false, false}, polynomial);
+  RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T> matrixFreeSolver(fct, inMesh, inIDs, outMesh, outIDs, {false, false}, polynomial, FactorizationPrecision::DOUBLE, 0., true, nThreads);
+  BOOST_TEST(!denseSolver.isMatrixFree());
+  BOOST_TEST(matrixFreeSolver.isMatrixFree());
+  BOOST_TEST(matrixFreeSolver.getInputSize() == denseSolver.getInputSize());
+  BOOST_TEST(matrixFreeSolver.getOutputSize() == denseSolver.getOutputSize());
+
+  // The integrated polynomial requires zero-padded data
+  Eigen::MatrixXd inValues = Eigen::MatrixXd::Zero(denseSolver.getInputSize(), 2);
+  for (const auto &v : inMesh.vertices()) {
+    inValues(v.getID(), 0) = std::sin(v.coord(0)) + 2 * v.coord(1);
+    inValues(v.getID(), 1) = v.coord(0) * v.coord(1);
+  }
+  Eigen::MatrixXd inValuesCopy = inValues;
+  BOOST_TEST(testing::equals(matrixFreeSolver.solveConsistent(inValues, polynomial), denseSolver.solveConsistent(inValuesCopy, polynomial), 1e-10));
+
+  Eigen::VectorXd outValues = Eigen::VectorXd::LinSpaced(denseSolver.getOutputSize(), 0.0, 1.0);
+  // Only the summation order differs, which is amplified by the conditioning of the interpolation matrix
+  const Eigen::VectorXd expectedConservative = denseSolver.solveConservative(outValues, polynomial);
+  BOOST_TEST((matrixFreeSolver.solveConservative(outValues, polynomial) - expectedConservative).norm() <= 1e-9 * expectedConservative.norm());
+}
+
+BOOST_AUTO_TEST_CASE(MatrixFree)
+{
+  PRECICE_TEST(1_rank);
+  for (unsigned int nThreads : {1, 3}) {
+    testMatrixFree(ThinPlateSplines(), Polynomial::ON, nThreads);
+    testMatrixFree(ThinPlateSplines(), Polynomial::SEPARATE, nThreads);
+    testMatrixFree(Gaussian(15.), Polynomial::OFF, nThreads);
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void testGreedyCenters(RADIAL_BASIS_FUNCTION_T fct, Polynomial polynomial, double tolerance)
+{
+  // The input mesh oversamples the smooth basis function
+  const int    n = 30;
+  const double h = 1.0 / (n - 1);
+  mesh::Mesh   inMesh("InMesh", 2, testing::nextMeshID());
+  mesh::Mesh   outMesh("OutMesh", 2, testing::nextMeshID());
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      inMesh.createVertex(Eigen::Vector2d(i * h, j * h));
+      outMesh.createVertex(Eigen::Vector2d((i + 0.3) * h, (j + 0.6) * h));
+    }
+  }
+  const auto inIDs  = boost::irange<Eigen::Index>(0, inMesh.nVertices());
+  const auto outIDs = boost::irange<Eigen::Index>(0, outMesh.nVertices());
+
+  RadialBasisFctSolver<RADIAL_BASIS_FUNCTION_T> solver(fct, inMesh, inIDs, outMesh, outIDs, {false, false}, polynomial, FactorizationPrecision::DOUBLE, 0., false, 1, tolerance);
+  BOOST_TEST(!solver.isSparse());
+  BOOST_TEST(solver.getNumberOfCenters() > 0);
+  BOOST_TEST(solver.getNumberOfCenters() < n * n / 2);
+  BOOST_TEST(solver.getInputSize() == n * n);
+  BOOST_TEST(solver.getOutputSize() == n * n);
+
+  const auto      f = [](const mesh::Vertex &v) { return std::sin(v.coord(0)) + 2 * v.coord(1) * v.coord(1); };
+  Eigen::VectorXd inValues(n * n);
+  for (const auto &v : inMesh.vertices()) {
+    inValues(v.getID()) = f(v);
+  }
+  Eigen::VectorXd expectedConsistent(n * n);
+  for (const auto &v : outMesh.vertices()) {
+    expectedConsistent(v.getID()) = f(v);
+  }
+  // The output vertices outside of the unit square extrapolate
+  Eigen::VectorXd       inValuesCopy = inValues;
+  const Eigen::VectorXd consistent   = solver.solveConsistent(inValuesCopy, polynomial);
+  BOOST_TEST((consistent - expectedConsistent).norm() <= 1e-2 * expectedConsistent.norm());
+
+  // The conservative mapping is the adjoint of the consistent mapping
+  const Eigen::VectorXd outValues    = Eigen::VectorXd::LinSpaced(n * n, 0.0, 1.0);
+  const Eigen::VectorXd conservative = solver.solveConservative(outValues, polynomial);
+  BOOST_TEST(std::abs(consistent.dot(outValues) - inValues.dot(conservative)) <= 1e-10 * std::abs(consistent.dot(outValues)));
+}
+
+BOOST_AUTO_TEST_CASE(GreedyCenters)
+{
+  PRECICE_TEST(1_rank);
+  testGreedyCenters(Gaussian(5.), Polynomial::OFF, 1e-3);
+  testGreedyCenters(Gaussian(5.), Polynomial::SEPARATE, 1e-3);
+  // Takes precedence over the sparse matrices, the power function of compactly supported functions decays slower
+  testGreedyCenters(CompactPolynomialC6(1.), Polynomial::OFF, 1e-2);
+}
+
+BOOST_AUTO_TEST_CASE(SharedOperator)
+{
+  PRECICE_TEST(1_rank);
+  using Solver  = RadialBasisFctSolver<ThinPlateSplines>;
+  using Mapping = RadialBasisFctMapping<Solver>;
+  auto create   = [](Mapping::Constraint constraint) {
+    return std::make_unique<Mapping>(constraint, 2, ThinPlateSplines(), std::array<bool, 3>{false, false, false}, Polynomial::SEPARATE);
+  };
+
+  PtrMesh meshA(new Mesh("MeshA", 2, testing::nextMeshID()));
+  PtrMesh meshB(new Mesh("MeshB", 2, testing::nextMeshID()));
+  for (int i = 0; i < 8; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      meshA->createVertex(Eigen::Vector2d(i, j));
+      meshB->createVertex(Eigen::Vector2d(i + 0.4, j * 1.1 - 0.2));
+    }
+  }
+  meshA->setGlobalNumberOfVertices(meshA->nVertices());
+  meshB->setGlobalNumberOfVertices(meshB->nVertices());
+
+  // A consistent mapping from A to B and a conservative mapping from B to A solve the same system on A
+  auto registry     = std::make_shared<OperatorRegistry>();
+  auto consistent   = create(Mapping::CONSISTENT);
+  auto conservative = create(Mapping::CONSERVATIVE);
+  auto reference    = create(Mapping::CONSERVATIVE);
+  consistent->setMeshes(meshA, meshB);
+  conservative->setMeshes(meshB, meshA);
+  reference->setMeshes(meshB, meshA);
+  consistent->setOperatorRegistry(registry, "A-B");
+  conservative->setOperatorRegistry(registry, "A-B");
+
+  consistent->computeMapping();
+  const auto solver = registry->find<Solver>("A-B");
+  BOOST_TEST_REQUIRE(solver != nullptr);
+  conservative->computeMapping();
+  reference->computeMapping();
+  BOOST_TEST(registry->find<Solver>("A-B") == solver);
+
+  const Eigen::VectorXd inValues = Eigen::VectorXd::LinSpaced(meshB->nVertices(), -1.0, 3.0);
+  time::Sample          inSample(1, inValues);
+  Eigen::VectorXd       outValues    = Eigen::VectorXd::Zero(meshA->nVertices());
+  Eigen::VectorXd       outReference = Eigen::VectorXd::Zero(meshA->nVertices());
+  conservative->map(inSample, outValues);
+  reference->map(inSample, outReference);
+  BOOST_TEST(testing::equals(outValues, outReference, 1e-12));
+
+  // A cleared mapping withdraws the operator, which stays alive for the other mapping
+  consistent->clear();
+  BOOST_TEST(registry->find<Solver>("A-B") == nullptr);
+  outValues.setZero();
+  conservative->map(inSample, outValues);
+  BOOST_TEST(testing::equals(outValues, outReference, 1e-12));
+}
+
 BOOST_AUTO_TEST_CASE(DeadAxis2Consistent)
 {
   PRECICE_TEST(1_rank);
@@ -1557,6 +1864,49 @@ BOOST_AUTO_TEST_CASE(DeadAxis3DConervative)
   testDeadAxis3d(Polynomial::SEPARATE, Mapping::CONSERVATIVE);
 }
 
+BOOST_AUTO_TEST_CASE(BatchMatchesSingleSamples)
+{
+  PRECICE_TEST(1_rank);
+  using Mapping        = RadialBasisFctMapping<RadialBasisFctSolver<ThinPlateSplines>>;
+  const int dimensions = 2;
+
+  PtrMesh meshA(new Mesh("MeshA", dimensions, testing::nextMeshID()));
+  PtrMesh meshB(new Mesh("MeshB", dimensions, testing::nextMeshID()));
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 6; ++j) {
+      meshA->createVertex(Eigen::Vector2d(i, j));
+      meshB->createVertex(Eigen::Vector2d(i * 0.9 + 0.3, j * 1.1 - 0.2));
+    }
+  }
+  meshA->setGlobalNumberOfVertices(meshA->nVertices());
+  meshB->setGlobalNumberOfVertices(meshB->nVertices());
+
+  for (auto constraint : {Mapping::CONSISTENT, Mapping::CONSERVATIVE}) {
+    Mapping mapping(constraint, dimensions, ThinPlateSplines(), {{false, false, false}}, Polynomial::SEPARATE);
+    mapping.setMeshes(meshA, meshB);
+    mapping.computeMapping();
+
+    // Vector data of three samples, which are mapped in a single batched solve
+    const Eigen::Index nIn  = dimensions * meshA->nVertices();
+    const Eigen::Index nOut = dimensions * meshB->nVertices();
+    const time::Sample inSample0(dimensions, Eigen::VectorXd::LinSpaced(nIn, 1.0, 12.0));
+    const time::Sample inSample1(dimensions, Eigen::VectorXd::LinSpaced(nIn, -3.0, 2.0));
+    const time::Sample inSample2(dimensions, Eigen::VectorXd::Constant(nIn, 0.5));
+
+    Eigen::MatrixXd outValues;
+    mapping.mapBatch({&inSample0, &inSample1, &inSample2}, outValues);
+    BOOST_TEST_REQUIRE(outValues.rows() == nOut);
+    BOOST_TEST_REQUIRE(outValues.cols() == 3);
+
+    int column = 0;
+    for (const auto *sample : {&inSample0, &inSample1, &inSample2}) {
+      Eigen::VectorXd outSingle = Eigen::VectorXd::Zero(nOut);
+      mapping.map(*sample, outSingle);
+      BOOST_TEST(testing::equals(outSingle, Eigen::VectorXd(outValues.col(column++)), 1e-10));
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Serial
 
 BOOST_AUTO_TEST_SUITE(Helper)
@@ -1593,6 +1943,38 @@ BOOST_AUTO_TEST_CASE(inverseTriangularMatrix)
   BOOST_CHECK_SMALL(min_abs_diff, tolerance);
 }
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+void testBatchedEvaluation(const RADIAL_BASIS_FUNCTION_T &fct)
+{
+  // Covers zero, the interior of the support, its boundary and the region outside of it, with a size that is no multiple of the vector width
+  std::vector<double> radii{0., 1e-16, 1e-3, 0.1, 0.25, 0.5, 0.7, 1.0 - 1e-12, 1.0, 1.3, 2.0, 5.0, 17.0};
+  std::vector<double> squaredRadii, values(radii.size());
+  for (double r : radii) {
+    squaredRadii.push_back(r * r);
+  }
+  fct.evaluate(squaredRadii, values);
+  for (std::size_t i = 0; i < radii.size(); ++i) {
+    BOOST_TEST(std::abs(values[i] - fct.evaluate(radii[i])) <= 1e-14 * std::max(1.0, std::abs(values[i])));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(BatchedEvaluation)
+{
+  PRECICE_TEST(1_rank);
+  testBatchedEvaluation(ThinPlateSplines());
+  testBatchedEvaluation(Multiquadrics(0.7));
+  testBatchedEvaluation(InverseMultiquadrics(0.7));
+  testBatchedEvaluation(VolumeSplines());
+  testBatchedEvaluation(Gaussian(2.));
+  testBatchedEvaluation(Gaussian(2., 1.));
+  testBatchedEvaluation(CompactThinPlateSplinesC2(1.));
+  testBatchedEvaluation(CompactPolynomialC0(1.));
+  testBatchedEvaluation(CompactPolynomialC2(1.));
+  testBatchedEvaluation(CompactPolynomialC4(1.));
+  testBatchedEvaluation(CompactPolynomialC6(1.));
+  testBatchedEvaluation(CompactPolynomialC8(1.));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Helper
 BOOST_AUTO_TEST_SUITE_END() // RadialBasisFunctionMapping
 BOOST_AUTO_TEST_SUITE_END()
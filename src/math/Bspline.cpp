@@ -12,6 +12,41 @@
 
 namespace precice::math {
 
+namespace {
+
+/**
+ * @brief Assembles the collocation matrix of the B-spline interpolation at the relative times ts
+ *
+ * The code for computing the control points is copied from Eigens bspline interpolation with some modifications
+ * https://gitlab.com/libeigen/eigen/-/blob/master/unsupported/Eigen/src/Splines/SplineFitting.h
+ */
+Eigen::SparseMatrix<double> collocationMatrix(const Eigen::VectorXd &ts, int splineDegree, const Eigen::VectorXd &knots)
+{
+  // We use a nxn sparse matrix with 2 + (n-2) * (d+1) entries and thus a fill-factor < 0.5.
+  Eigen::DenseIndex                   n = ts.size();
+  std::vector<Eigen::Triplet<double>> matrixEntries;
+  matrixEntries.reserve(2 + (n - 2) * (splineDegree + 1));
+
+  matrixEntries.emplace_back(0, 0, 1.0);
+  for (Eigen::DenseIndex i = 1; i < n - 1; ++i) {
+    const Eigen::DenseIndex span      = Eigen::Spline<double, 1>::Span(ts[i], splineDegree, knots);
+    auto                    basisFunc = Eigen::Spline<double, 1>::BasisFunctions(ts[i], splineDegree, knots);
+
+    for (Eigen::DenseIndex j = 0; j < splineDegree + 1; ++j) {
+      matrixEntries.emplace_back(i, span - splineDegree + j, basisFunc(j));
+    }
+  }
+  matrixEntries.emplace_back(n - 1, n - 1, 1.0);
+  PRECICE_ASSERT(matrixEntries.capacity() == matrixEntries.size(), matrixEntries.capacity(), matrixEntries.size(), n, splineDegree);
+
+  Eigen::SparseMatrix<double> A(n, n);
+  A.setFromTriplets(matrixEntries.begin(), matrixEntries.end());
+  A.makeCompressed();
+  return A;
+}
+
+} // namespace
+
 Bspline::Bspline(Eigen::VectorXd ts, const Eigen::MatrixXd &xs, int splineDegree)
 {
 
@@ -33,26 +68,7 @@ Bspline::Bspline(Eigen::VectorXd ts, const Eigen::MatrixXd &xs, int splineDegree
   Eigen::KnotAveraging(ts, splineDegree, _knots);
 
   // 2. Compute the control points
-  // We use a nxn sparse matrix with 2 + (n-2) * (d+1) entries and thus a fill-factor < 0.5.
-  Eigen::DenseIndex                   n = xs.cols();
-  std::vector<Eigen::Triplet<double>> matrixEntries;
-  matrixEntries.reserve(2 + (n - 2) * (splineDegree + 1));
-
-  matrixEntries.emplace_back(0, 0, 1.0);
-  for (Eigen::DenseIndex i = 1; i < n - 1; ++i) {
-    const Eigen::DenseIndex span      = Eigen::Spline<double, 1>::Span(ts[i], splineDegree, _knots);
-    auto                    basisFunc = Eigen::Spline<double, 1>::BasisFunctions(ts[i], splineDegree, _knots);
-
-    for (Eigen::DenseIndex j = 0; j < splineDegree + 1; ++j) {
-      matrixEntries.emplace_back(i, span - splineDegree + j, basisFunc(j));
-    }
-  }
-  matrixEntries.emplace_back(n - 1, n - 1, 1.0);
-  PRECICE_ASSERT(matrixEntries.capacity() == matrixEntries.size(), matrixEntries.capacity(), matrixEntries.size(), n, splineDegree);
-
-  Eigen::SparseMatrix<double> A(n, n);
-  A.setFromTriplets(matrixEntries.begin(), matrixEntries.end());
-  A.makeCompressed();
+  Eigen::SparseMatrix<double> A = collocationMatrix(ts, splineDegree, _knots);
 
   Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> qr;
   qr.analyzePattern(A);
@@ -75,4 +91,40 @@ Eigen::VectorXd Bspline::interpolateAt(double t) const
 
   return interpolated;
 }
+
+Eigen::VectorXd Bspline::computeWeights(Eigen::VectorXd ts, int splineDegree, double t)
+{
+  PRECICE_ASSERT(ts.size() >= 2, "Interpolation requires at least 2 samples");
+  PRECICE_ASSERT(std::is_sorted(ts.begin(), ts.end()), "Timestamps must be sorted");
+
+  const double tsMin        = ts(0);
+  const double tsMax        = ts(ts.size() - 1);
+  auto         relativeTime = [tsMin, tsMax](double time) -> double { return (time - tsMin) / (tsMax - tsMin); };
+  ts                        = ts.unaryExpr(relativeTime);
+
+  // transform t to the relative interval [0; 1]
+  const double tRelative = std::clamp(relativeTime(t), 0.0, 1.0);
+
+  Eigen::VectorXd knots;
+  Eigen::KnotAveraging(ts, splineDegree, knots);
+
+  // The interpolant is x(t) = ctrls^T * b(t) with the control points ctrls = A^-1 * xs^T and the basis functions b(t).
+  // Hence, x(t) = xs * A^-T * b(t) and the weights w(t) = A^-T * b(t) are independent of the data xs.
+  const Eigen::DenseIndex span      = Eigen::Spline<double, 1>::Span(tRelative, splineDegree, knots);
+  auto                    basisFunc = Eigen::Spline<double, 1>::BasisFunctions(tRelative, splineDegree, knots);
+
+  Eigen::VectorXd basis = Eigen::VectorXd::Zero(ts.size());
+  for (Eigen::DenseIndex j = 0; j < splineDegree + 1; ++j) {
+    basis[span - splineDegree + j] = basisFunc(j);
+  }
+
+  Eigen::SparseMatrix<double> At = collocationMatrix(ts, splineDegree, knots).transpose();
+  At.makeCompressed();
+
+  Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> qr;
+  qr.analyzePattern(At);
+  qr.factorize(At);
+
+  return qr.solve(basis);
+}
 } // namespace precice::math
@@ -26,6 +26,19 @@ public:
 
   Eigen::VectorXd interpolateAt(double t) const;
 
+  /**
+ * @brief Computes the weights of the B-Spline interpolation at t
+ *
+ * The B-Spline interpolant is linear in the interpolated data. It can thus be written as x(t) = xs * w(t), where the weights w(t) only depend on ts, the spline degree and t.
+ * This allows to reuse the weights for all data which is sampled at the same timestamps.
+ *
+ * @param ts the timestamps which must be sorted from lowest to highest and contain at least 2 samples.
+ * @param splineDegree the used spline degree, which has to be larger than 0
+ * @param t must be within [ts(0); ts(ts.size() - 1)].
+ * @return the weights w(t), one per timestamp in ts
+ */
+  static Eigen::VectorXd computeWeights(Eigen::VectorXd ts, int splineDegree, double t);
+
 private:
   Eigen::VectorXd _knots; // Cache to store previously computed knots
   Eigen::MatrixXd _ctrls; // Cache to store previously computed control points
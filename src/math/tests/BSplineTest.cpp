@@ -138,5 +138,23 @@ BOOST_AUTO_TEST_CASE(FloatingPointAccuracy) // see https://github.com/precice/pr
   BOOST_TEST(equals(bspline.interpolateAt(256.1 + 0.1), Eigen::Vector3d(2, 20, 200)));
 }
 
+BOOST_AUTO_TEST_CASE(WeightsMatchInterpolation)
+{
+  PRECICE_TEST(1_rank);
+  Eigen::VectorXd ts(5);
+  ts << 0, 0.1, 0.4, 0.5, 1.0;
+  Eigen::MatrixXd xs(3, 5);
+  xs << 1, 2, 3, -1, 0, 10, 20, 30, 5, 7, 100, 200, 300, 150, -10;
+
+  for (int degree = 1; degree <= 3; ++degree) {
+    precice::math::Bspline bspline(ts, xs, degree);
+    for (double t : {0.0, 0.05, 0.3, 0.45, 0.75, 1.0}) {
+      const Eigen::VectorXd weights = precice::math::Bspline::computeWeights(ts, degree, t);
+      BOOST_TEST(weights.size() == ts.size());
+      BOOST_TEST(equals(xs * weights, bspline.interpolateAt(t), 1e-12));
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // BSpline
 BOOST_AUTO_TEST_SUITE_END() // Math
@@ -60,6 +60,12 @@ Eigen::VectorXd Data::sampleAtTime(double time) const
   return _waveform.sample(time);
 }
 
+void Data::sampleAtTime(double time, ::precice::span<const VertexID> vertices, ::precice::span<double> values) const
+{
+  PRECICE_ASSERT(values.size() == vertices.size() * static_cast<std::size_t>(_dimensions), values.size(), vertices.size(), _dimensions);
+  _waveform.sample(time, vertices, values);
+}
+
 int Data::getWaveformDegree() const
 {
   return _waveform.timeStepsStorage().getInterpolationDegree();
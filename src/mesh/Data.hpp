@@ -84,6 +84,15 @@ public:
    */
   Eigen::VectorXd sampleAtTime(double time) const;
 
+  /**
+   * @brief Samples _waveform at given time for the given vertices only
+   *
+   * @param time Time where the sampling happens.
+   * @param vertices Ids of the vertices to sample.
+   * @param values Buffer receiving the values of _waveform at time \ref time for the given vertices.
+   */
+  void sampleAtTime(double time, ::precice::span<const VertexID> vertices, ::precice::span<double> values) const;
+
   /**
    * @brief get degree of _waveform.
    *
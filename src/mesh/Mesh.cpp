@@ -36,6 +36,7 @@ Mesh::Mesh(
 {
   PRECICE_ASSERT((_dimensions == 2) || (_dimensions == 3), _dimensions);
   PRECICE_ASSERT(_name != std::string(""));
+  _vertexCoordinates.resize(_dimensions, 0);
 }
 
 Vertex &Mesh::vertex(VertexID id)
@@ -65,6 +66,36 @@ std::size_t Mesh::nVertices() const
   return _vertices.size();
 }
 
+Eigen::Map<const Eigen::MatrixXd> Mesh::vertexCoordinates() const
+{
+  return {_vertexCoordinates.data(), _dimensions, static_cast<Eigen::Index>(nVertices())};
+}
+
+Eigen::Map<const Eigen::VectorXi> Mesh::vertexGlobalIndices() const
+{
+  return {_vertexGlobalIndices.data(), static_cast<Eigen::Index>(nVertices())};
+}
+
+Eigen::Map<const Mesh::VertexFlags> Mesh::vertexOwners() const
+{
+  return {_vertexOwners.data(), static_cast<Eigen::Index>(nVertices())};
+}
+
+Eigen::Map<const Mesh::VertexFlags> Mesh::vertexTags() const
+{
+  return {_vertexTags.data(), static_cast<Eigen::Index>(nVertices())};
+}
+
+void Mesh::updateVertex(const Vertex &vertex)
+{
+  const VertexID id = vertex.getID();
+  PRECICE_ASSERT(isValidVertexID(id) && &_vertices[id] == &vertex, id, getName());
+  std::copy_n(vertex.rawCoords().data(), _dimensions, _vertexCoordinates.col(id).data());
+  _vertexGlobalIndices(id) = vertex.getGlobalIndex();
+  _vertexOwners(id)        = vertex.isOwner();
+  _vertexTags(id)          = vertex.isTagged();
+}
+
 Mesh::EdgeContainer &Mesh::edges()
 {
   return _edges;
@@ -104,8 +135,17 @@ Vertex &Mesh::createVertex(const Eigen::Ref<const Eigen::VectorXd> &coords)
 {
   PRECICE_ASSERT(coords.size() == _dimensions, coords.size(), _dimensions);
   auto nextID = _vertices.size();
-  _vertices.emplace_back(coords, nextID);
-  return _vertices.back();
+  if (static_cast<Eigen::Index>(nextID) == _vertexCoordinates.cols()) {
+    const Eigen::Index capacity = std::max<Eigen::Index>(16, 2 * _vertexCoordinates.cols());
+    _vertexCoordinates.conservativeResize(Eigen::NoChange, capacity);
+    _vertexGlobalIndices.conservativeResize(capacity);
+    _vertexOwners.conservativeResize(capacity);
+    _vertexTags.conservativeResize(capacity);
+  }
+  auto &vertex = _vertices.emplace_back(coords, nextID);
+  vertex._mesh = this;
+  updateVertex(vertex);
+  return vertex;
 }
 
 Edge &Mesh::createEdge(
@@ -254,12 +294,18 @@ void Mesh::computeBoundingBox()
 }
 
 void Mesh::clear()
+{
+  reset();
+  _index.clear();
+}
+
+void Mesh::reset()
 {
   _triangles.clear();
   _edges.clear();
   _vertices.clear();
   _tetrahedra.clear();
-  _index.clear();
+  _index.markOutdated();
 
   for (mesh::PtrData &data : _data) {
     data->values().resize(0);
@@ -84,6 +84,27 @@ public:
   /// Returns the number of vertices
   std::size_t nVertices() const;
 
+  /// Flags of the vertices with an entry per vertex
+  using VertexFlags = Eigen::Array<bool, Eigen::Dynamic, 1>;
+
+  /**
+   * @brief Returns the coordinates of all vertices as the columns of a dims x nVertices() matrix
+   *
+   * The vertex arrays store the coordinates and attributes of the vertices contiguously and mirror every change
+   * of the vertices. This allows to stream them without accessing the vertices one by one.
+   * Creating vertices invalidates the views.
+   */
+  Eigen::Map<const Eigen::MatrixXd> vertexCoordinates() const;
+
+  /// Returns the global indices of all vertices, see vertexCoordinates()
+  Eigen::Map<const Eigen::VectorXi> vertexGlobalIndices() const;
+
+  /// Returns the ownership flags of all vertices, see vertexCoordinates()
+  Eigen::Map<const VertexFlags> vertexOwners() const;
+
+  /// Returns the tags of all vertices, see vertexCoordinates()
+  Eigen::Map<const VertexFlags> vertexTags() const;
+
   /// Does the mesh contain any vertices?
   bool empty() const
   {
@@ -230,6 +251,9 @@ public:
    */
   void clear();
 
+  /// Removes all mesh elements and data values like clear(), but keeps the index to update it once the mesh is redefined
+  void reset();
+
   /// Clears the partitioning information
   void clearPartitioning();
 
@@ -354,6 +378,12 @@ private:
   TriangleContainer _triangles;
   TetraContainer    _tetrahedra;
 
+  /// Vertex arrays with a column or entry per vertex, whose capacity grows geometrically
+  Eigen::MatrixXd _vertexCoordinates;
+  Eigen::VectorXi _vertexGlobalIndices;
+  VertexFlags     _vertexOwners;
+  VertexFlags     _vertexTags;
+
   /// Data hold by the vertices of the mesh.
   DataContainer _data;
 
@@ -394,6 +424,11 @@ private:
 
   query::Index _index;
 
+  friend class Vertex;
+
+  /// Mirrors the coordinates and attributes of a vertex of this mesh in the vertex arrays
+  void updateVertex(const Vertex &vertex);
+
   /// Removes all duplicate connectivity.
   void removeDuplicates();
 
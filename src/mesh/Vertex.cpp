@@ -1,5 +1,6 @@
 #include "Vertex.hpp"
 #include <Eigen/Core>
+#include "mesh/Mesh.hpp"
 #include "utils/EigenIO.hpp"
 
 namespace precice::mesh {
@@ -17,6 +18,9 @@ int Vertex::getGlobalIndex() const
 void Vertex::setGlobalIndex(int globalIndex)
 {
   _globalIndex = globalIndex;
+  if (_mesh) {
+    updateMesh();
+  }
 }
 
 bool Vertex::isOwner() const
@@ -27,6 +31,9 @@ bool Vertex::isOwner() const
 void Vertex::setOwner(bool owner)
 {
   _owner = owner;
+  if (_mesh) {
+    updateMesh();
+  }
 }
 
 bool Vertex::isTagged() const
@@ -37,6 +44,14 @@ bool Vertex::isTagged() const
 void Vertex::tag()
 {
   _tagged = true;
+  if (_mesh) {
+    updateMesh();
+  }
+}
+
+void Vertex::updateMesh() const
+{
+  _mesh->updateVertex(*this);
 }
 
 std::ostream &operator<<(std::ostream &os, Vertex const &v)
@@ -12,7 +12,17 @@
 namespace precice {
 namespace mesh {
 
-/// Vertex of a mesh.
+class Mesh;
+
+/**
+ * @brief Vertex of a mesh.
+ *
+ * Vertices created by a Mesh write their coordinates and attributes through to the
+ * vertex arrays of the mesh, see Mesh::vertexCoordinates(). Copies are not linked to the mesh.
+ * The link costs a pointer per vertex and a write to the mesh per setter call. The setters are
+ * only called while the mesh is set up or partitioned, whereas the arrays spare gathering the
+ * coordinates in every mapping computation and export.
+ */
 class Vertex {
 public:
   //( Used as the raw representation of the coordinates
@@ -24,6 +34,15 @@ public:
       const VECTOR_T &coordinates,
       VertexID        id);
 
+  Vertex(const Vertex &other);
+
+  /**
+   * @brief Copies the coordinates and attributes, but keeps the link to the mesh of this vertex
+   *
+   * A vertex of a mesh also keeps its ID, which locates it in the vertex arrays of the mesh.
+   */
+  Vertex &operator=(const Vertex &other);
+
   /// Returns spatial dimensionality of vertex.
   int getDimensions() const;
 
@@ -81,6 +100,14 @@ private:
 
   /// true if this vertex is tagged for partition
   bool _tagged = false;
+
+  /// The mesh whose vertex arrays mirror this vertex, if any
+  Mesh *_mesh = nullptr;
+
+  friend class Mesh;
+
+  /// Writes the coordinates and attributes to the vertex arrays of the mesh
+  void updateMesh() const;
 };
 
 // ------------------------------------------------------ HEADER IMPLEMENTATION
@@ -106,6 +133,35 @@ void Vertex::setCoords(
   _coords[0] = coordinates[0];
   _coords[1] = coordinates[1];
   _coords[2] = (_dim == 3) ? coordinates[2] : 0.0;
+  if (_mesh) {
+    updateMesh();
+  }
+}
+
+inline Vertex::Vertex(const Vertex &other)
+    : _coords(other._coords),
+      _dim(other._dim),
+      _id(other._id),
+      _globalIndex(other._globalIndex),
+      _owner(other._owner),
+      _tagged(other._tagged)
+{
+}
+
+inline Vertex &Vertex::operator=(const Vertex &other)
+{
+  PRECICE_ASSERT(!_mesh || _dim == other._dim, _dim, other._dim);
+  _coords      = other._coords;
+  _dim         = other._dim;
+  _globalIndex = other._globalIndex;
+  _owner       = other._owner;
+  _tagged      = other._tagged;
+  if (_mesh) {
+    updateMesh();
+  } else {
+    _id = other._id;
+  }
+  return *this;
 }
 
 inline VertexID Vertex::getID() const
@@ -1091,5 +1091,66 @@ BOOST_AUTO_TEST_CASE(Complex)
 }
 
 BOOST_AUTO_TEST_SUITE_END();
+
+BOOST_AUTO_TEST_CASE(VertexArrays)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh("MyMesh", 2, testing::nextMeshID());
+  BOOST_TEST(mesh.vertexCoordinates().rows() == 2);
+  BOOST_TEST(mesh.vertexCoordinates().cols() == 0);
+
+  // Exceed the initial capacity of the arrays
+  for (int i = 0; i < 40; ++i) {
+    mesh.createVertex(Vector2d(i, -i)).setGlobalIndex(100 + i);
+  }
+  mesh.vertex(3).setCoords(Vector2d(7.0, 8.0));
+  mesh.vertex(5).setOwner(false);
+  mesh.vertex(6).tag();
+
+  const auto coordinates = mesh.vertexCoordinates();
+  BOOST_TEST(coordinates.cols() == 40);
+  BOOST_TEST(mesh.vertexGlobalIndices().size() == 40);
+  for (const Vertex &v : mesh.vertices()) {
+    BOOST_TEST(equals(coordinates.col(v.getID()), v.getCoords()));
+    BOOST_TEST(mesh.vertexGlobalIndices()(v.getID()) == v.getGlobalIndex());
+    BOOST_TEST(mesh.vertexOwners()(v.getID()) == v.isOwner());
+    BOOST_TEST(mesh.vertexTags()(v.getID()) == v.isTagged());
+  }
+  BOOST_TEST(equals(coordinates.col(3), Vector2d(7.0, 8.0)));
+  BOOST_TEST(!mesh.vertexOwners()(5));
+  BOOST_TEST(mesh.vertexTags()(6));
+
+  // Copies of vertices are not linked to the mesh
+  Vertex copy = mesh.vertex(2);
+  copy.setCoords(Vector2d(-1.0, -1.0));
+  BOOST_TEST(equals(mesh.vertexCoordinates().col(2), Vector2d(2.0, -2.0)));
+
+  // Assigning to a vertex of the mesh updates the arrays
+  mesh.vertex(2) = copy;
+  BOOST_TEST(equals(mesh.vertexCoordinates().col(2), Vector2d(-1.0, -1.0)));
+
+  // The assigned vertex keeps its ID and slot, even if the other vertex has a different ID
+  Vertex other(Vector2d(4.0, 5.0), 7);
+  other.setGlobalIndex(42);
+  other.setOwner(false);
+  mesh.vertex(2) = other;
+  BOOST_TEST(mesh.vertex(2).getID() == 2);
+  BOOST_TEST(equals(mesh.vertexCoordinates().col(2), Vector2d(4.0, 5.0)));
+  BOOST_TEST(mesh.vertexGlobalIndices()(2) == 42);
+  BOOST_TEST(!mesh.vertexOwners()(2));
+  BOOST_TEST(equals(mesh.vertexCoordinates().col(7), mesh.vertex(7).getCoords()));
+  BOOST_TEST(mesh.vertexGlobalIndices()(7) == mesh.vertex(7).getGlobalIndex());
+
+  // Unlinked vertices copy the ID
+  copy = other;
+  BOOST_TEST(copy.getID() == 7);
+
+  mesh.clear();
+  BOOST_TEST(mesh.vertexCoordinates().cols() == 0);
+  mesh.createVertex(Vector2d(1.0, 2.0));
+  BOOST_TEST(equals(mesh.vertexCoordinates().col(0), Vector2d(1.0, 2.0)));
+  BOOST_TEST(mesh.vertexGlobalIndices()(0) == -1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Mesh
 BOOST_AUTO_TEST_SUITE_END() // Mesh
@@ -1,6 +1,7 @@
 #include <iterator>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "precice/impl/DataContext.hpp"
 #include "utils/EigenHelperFunctions.hpp"
@@ -102,17 +103,14 @@ int DataContext::mapData(std::optional<double> after, bool skipZero)
                   "The expected exchange tag should look like this: <exchange data=\"{0}\" mesh=\"{1}\" from=... to=... />.",
                   context.fromData->getName(), context.mapping->getInputMesh()->getName(), context.mapping->getOutputMesh()->getName());
 
-    // linear lookup should be sufficient here
-    const auto timestampExists = [times = context.toData->timeStepsStorage().getTimes()](double lookup) -> bool {
-      return std::any_of(times.data(), std::next(times.data(), times.size()), [lookup](double time) {
-        return math::equals(time, lookup);
-      });
-    };
-
     auto &mapping = *context.mapping;
 
     const auto dataDims = context.fromData->getDimensions();
 
+    // Collect the stamples to map. Both storages are sorted by time, hence existing stamples are found in a single pass.
+    const auto                         existingTimes = context.toData->timeStepsStorage().getTimes();
+    Eigen::Index                       existing      = 0;
+    std::vector<const time::Stample *> pending;
     for (const auto &stample : context.fromData->stamples()) {
       // skip stamples before given time
       if (after && math::smallerEquals(stample.timestamp, *after)) {
@@ -120,34 +118,63 @@ int DataContext::mapData(std::optional<double> after, bool skipZero)
         continue;
       }
       // skip existing stamples
-      if (timestampExists(stample.timestamp)) {
+      while (existing < existingTimes.size() && math::smaller(existingTimes[existing], stample.timestamp)) {
+        ++existing;
+      }
+      if (existing < existingTimes.size() && math::equals(existingTimes[existing], stample.timestamp)) {
         PRECICE_DEBUG("Skipping stample t={} (exists)", stample.timestamp);
         continue;
       }
+      pending.push_back(&stample);
+    }
 
-      time::Sample outSample{
-          dataDims,
-          Eigen::VectorXd::Zero(dataDims * mapping.getOutputMesh()->nVertices())};
-
-      // Note that the l2norm is only computed during initialization due to short-circuit evaluation in C++
-      bool skipMapping = skipZero && (utils::IntraComm::l2norm(stample.sample.values) < math::NUMERICAL_ZERO_DIFFERENCE);
-
+    // Determine the stamples to skip.
+    // Note that the l2norm is only computed during initialization due to short-circuit evaluation in C++
+    std::vector<bool>                 skipMapping(pending.size());
+    std::vector<const time::Sample *> toMap;
+    for (std::size_t i = 0; i < pending.size(); ++i) {
+      skipMapping[i] = skipZero && (utils::IntraComm::l2norm(pending[i]->sample.values) < math::NUMERICAL_ZERO_DIFFERENCE);
       PRECICE_INFO("Mapping \"{}\" for t={} from \"{}\" to \"{}\"{}",
-                   getDataName(), stample.timestamp, mapping.getInputMesh()->getName(), mapping.getOutputMesh()->getName(),
-                   (skipMapping ? " (skipped zero sample)" : ""));
-      if (!skipMapping) {
-        if (mapping.requiresInitialGuess()) {
-          const FromToDataIDs key{context.fromData->getID(), context.toData->getID()};
-          mapping.map(stample.sample, outSample.values, _initialGuesses[key]);
-        } else {
-          mapping.map(stample.sample, outSample.values);
+                   getDataName(), pending[i]->timestamp, mapping.getInputMesh()->getName(), mapping.getOutputMesh()->getName(),
+                   (skipMapping[i] ? " (skipped zero sample)" : ""));
+      if (!skipMapping[i]) {
+        toMap.push_back(&pending[i]->sample);
+      }
+    }
+
+    time::Sample outSample{dataDims, Eigen::VectorXd::Zero(dataDims * mapping.getOutputMesh()->nVertices())};
+
+    if (mapping.requiresInitialGuess()) {
+      // Every mapping updates the initial guess of the next one, hence we map stample by stample
+      const FromToDataIDs key{context.fromData->getID(), context.toData->getID()};
+      for (std::size_t i = 0; i < pending.size(); ++i) {
+        outSample.values.setZero();
+        if (!skipMapping[i]) {
+          mapping.map(pending[i]->sample, outSample.values, _initialGuesses[key]);
+          PRECICE_DEBUG("Mapped values (t={}) = {}", pending[i]->timestamp, utils::previewRange(3, outSample.values));
+          ++executedMappings;
         }
-        PRECICE_DEBUG("Mapped values (t={}) = {}", stample.timestamp, utils::previewRange(3, outSample.values));
-        ++executedMappings;
+        // Store data from mapping buffer in storage
+        context.toData->setSampleAtTime(pending[i]->timestamp, outSample);
       }
+      continue;
+    }
 
+    // Map all stamples in a single pass over the mapping
+    if (!toMap.empty()) {
+      mapping.mapBatch(toMap, _mappedValues);
+    }
+
+    for (std::size_t i = 0, mapped = 0; i < pending.size(); ++i) {
+      if (skipMapping[i]) {
+        outSample.values.setZero();
+      } else {
+        outSample.values = _mappedValues.col(mapped++);
+        PRECICE_DEBUG("Mapped values (t={}) = {}", pending[i]->timestamp, utils::previewRange(3, outSample.values));
+        ++executedMappings;
+      }
       // Store data from mapping buffer in storage
-      context.toData->setSampleAtTime(stample.timestamp, std::move(outSample));
+      context.toData->setSampleAtTime(pending[i]->timestamp, outSample);
     }
   }
   return executedMappings;
@@ -166,6 +166,9 @@ private:
 
   using FromToDataIDs = std::pair<int, int>;
   std::map<FromToDataIDs, Eigen::VectorXd> _initialGuesses;
+
+  /// Buffer of the batched mappings, reused across calls of mapData
+  Eigen::MatrixXd _mappedValues;
 };
 
 } // namespace impl
@@ -650,7 +650,8 @@ void ParticipantImpl::resetMesh(
 
   PRECICE_DEBUG("Clear mesh positions for mesh \"{}\"", context.mesh->getName());
   _meshLock.unlock(meshName);
-  context.mesh->clear();
+  // Keep the index, as the redefined mesh often resembles the previous one
+  context.mesh->reset();
 }
 
 VertexID ParticipantImpl::setMeshVertex(
@@ -2,13 +2,28 @@
 #include <algorithm>
 #include <boost/iterator/function_output_iterator.hpp>
 #include <boost/range/irange.hpp>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <type_traits>
 #include <utility>
 
 #include "logging/LogMacros.hpp"
+#include "math/math.hpp"
 #include "precice/impl/Types.hpp"
 #include "profiling/Event.hpp"
 #include "query/Index.hpp"
+#include "query/impl/MortonOrder.hpp"
+#include "query/impl/PackedRTree.hpp"
 #include "query/impl/RTreeAdapter.hpp"
+#include "query/impl/VertexGrid.hpp"
+#include "utils/Threading.hpp"
 
 namespace precice::query {
 
@@ -22,132 +37,735 @@ using EdgeTraits        = impl::RTreeTraits<mesh::Edge>;
 using TriangleTraits    = impl::RTreeTraits<mesh::Triangle>;
 using TetrahedronTraits = impl::RTreeTraits<mesh::Tetrahedron>;
 
-struct MeshIndices {
-  VertexTraits::Ptr      vertexRTree;
-  EdgeTraits::Ptr        edgeRTree;
-  TriangleTraits::Ptr    triangleRTree;
-  TetrahedronTraits::Ptr tetraRTree;
+namespace {
+
+/// Minimal amount of queries per thread, which amortizes the cost of spawning the thread
+constexpr std::size_t minQueriesPerThread = 1024;
+
+/**
+ * @brief Calls query(chunk, column, location) for every column of the locations
+ *
+ * Spatially close queries traverse the same nodes of the index trees, which keeps them in cache.
+ * Hence, the locations are processed in Morton order and the resulting sequence is split into nChunks concurrent chunks.
+ * The required index trees have to be built beforehand, as only queries of the trees are safe to run concurrently.
+ */
+template <typename Query>
+void forEachLocation(const Eigen::Ref<const Eigen::MatrixXd> &locations, std::size_t nChunks, Query &&query)
+{
+  if (locations.cols() == 0) {
+    return;
+  }
+  const auto order = impl::mortonOrder(locations);
+  utils::parallelForChunks(order.size(), nChunks, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+    Eigen::VectorXd location(locations.rows());
+    for (std::size_t i = begin; i < end; ++i) {
+      location = locations.col(order[i]);
+      query(chunk, order[i], location);
+    }
+  });
+}
+
+/**
+ * @brief Runs query(location, ids) for every column of the locations and gathers the appended ids
+ *
+ * Every chunk appends to its own buffer, which are gathered in the order of the locations afterwards.
+ */
+template <typename Query>
+BatchMatches gatherLocations(const Eigen::Ref<const Eigen::MatrixXd> &locations, unsigned int nThreads, Query &&query)
+{
+  const std::size_t n       = locations.cols();
+  const auto        nChunks = utils::chunkCount(n, minQueriesPerThread, nThreads);
+
+  std::vector<std::vector<VertexID>> chunkIDs(nChunks);
+  std::vector<std::size_t>           chunkOf(n);
+  std::vector<std::size_t>           chunkBegin(n);
+
+  BatchMatches matches;
+  matches.offsets.assign(n + 1, 0);
+  forEachLocation(locations, nChunks, [&](std::size_t chunk, std::size_t column, const Eigen::VectorXd &location) {
+    auto &ids          = chunkIDs[chunk];
+    chunkOf[column]    = chunk;
+    chunkBegin[column] = ids.size();
+    query(location, ids);
+    matches.offsets[column + 1] = ids.size() - chunkBegin[column];
+  });
+
+  std::partial_sum(matches.offsets.begin(), matches.offsets.end(), matches.offsets.begin());
+  matches.ids.resize(matches.offsets.back());
+  for (std::size_t column = 0; column < n; ++column) {
+    const auto begin = chunkIDs[chunkOf[column]].begin() + chunkBegin[column];
+    std::copy(begin, begin + matches.count(column), matches.ids.begin() + matches.offsets[column]);
+  }
+  return matches;
+}
+
+/// Runs query(location) for every column of the locations and returns the projections in the order of the locations
+template <typename Query>
+std::vector<ProjectionMatch> projectLocations(const Eigen::Ref<const Eigen::MatrixXd> &locations, unsigned int nThreads, Query &&query)
+{
+  // ProjectionMatch is not default constructible, hence the slots are filled concurrently before collecting them
+  std::vector<std::optional<ProjectionMatch>> slots(locations.cols());
+  forEachLocation(locations, utils::chunkCount(slots.size(), minQueriesPerThread, nThreads), [&](std::size_t, std::size_t column, const Eigen::VectorXd &location) {
+    slots[column].emplace(query(location));
+  });
+
+  std::vector<ProjectionMatch> matches;
+  matches.reserve(slots.size());
+  for (auto &slot : slots) {
+    matches.push_back(std::move(*slot));
+  }
+  return matches;
+}
+
+} // namespace
+
+//
+// Index backends
+//
+// Both backends provide the same queries, which build the required tree on first use:
+// - closestVertices/closestEdges/closestTriangles(mesh, location, n, out) call out(id) for the n closest primitives
+// - visitVerticesInsideBox(mesh, box, visit) calls visit(id) for the vertices inside the box until visit returns true
+// - enclosingTetrahedra(mesh, location, out) calls out(id) for the tetrahedra whose box contains the location
+//
+
+#ifndef PRECICE_PACKED_INDEX
+
+namespace {
+
+/// Geometries of the primitives as indexed by the rtrees
+VertexTraits::Geometry geometryOf(const mesh::Vertex &vertex)
+{
+  return vertex.rawCoords();
+}
+
+EdgeTraits::Geometry geometryOf(const mesh::Edge &edge)
+{
+  return {edge.vertex(0).rawCoords(), edge.vertex(1).rawCoords()};
+}
+
+TriangleTraits::Geometry geometryOf(const mesh::Triangle &triangle)
+{
+  return bg::return_envelope<RTreeBox>(triangle);
+}
+
+// We use a custom function to compute the AABB, because bg::return_envelope was designed for polygons.
+TetrahedronTraits::Geometry geometryOf(const mesh::Tetrahedron &tetra)
+{
+  return makeBox(tetra);
+}
+
+/// Corners spanning a geometry, which compare geometries exactly, as any change has to be reflected in the rtree
+using GeometryKey = std::pair<mesh::Vertex::RawCoords, mesh::Vertex::RawCoords>;
+
+GeometryKey keyOf(const VertexTraits::Geometry &point)
+{
+  return {point, point};
+}
+
+GeometryKey keyOf(const EdgeTraits::Geometry &segment)
+{
+  return {segment.first, segment.second};
+}
+
+GeometryKey keyOf(const RTreeBox &box)
+{
+  return {box.min_corner(), box.max_corner()};
+}
+
+/// Fraction of updated primitives since the last bulk-load, beyond which the tree is rebuilt
+constexpr double maxUpdatedFraction = 0.1;
+
+/**
+ * @brief An rtree of the primitives of a mesh, which is updated in place after the primitives changed
+ *
+ * The rtree keeps a snapshot of the geometries of the primitives. Once marked as outdated, the snapshot is
+ * compared to the primitives on the next access and only the inserted, removed and moved primitives are updated
+ * in the rtree. As incremental updates degrade the quality of the rtree compared to bulk-loading it, the tree is
+ * rebuilt as soon as more than maxUpdatedFraction of the primitives were updated since it was bulk-loaded.
+ * The snapshot is compared by index, hence, the tree is also rebuilt if the primitives were reordered.
+ */
+template <class Primitive>
+class UpdatableRTree {
+public:
+  using Traits = impl::RTreeTraits<Primitive>;
+
+  /**
+   * @brief Reads the geometry of a primitive for the rtree
+   *
+   * Vertices and edges are read from the mesh as long as the tree is not updated, as before the tree was updatable.
+   * Triangles and tetrahedra are always read from the snapshot, which saves computing their boxes on every access.
+   * The tree locates the primitives to remove using their old geometries, hence, all geometries are read from the
+   * snapshot during updates.
+   */
+  class IndexGetter {
+  public:
+    using result_type = typename Traits::Geometry;
+
+    explicit IndexGetter(const UpdatableRTree &tree)
+        : _tree(&tree) {}
+
+    result_type operator()(typename Traits::IndexType i) const
+    {
+      if constexpr (std::is_same_v<Primitive, mesh::Vertex> || std::is_same_v<Primitive, mesh::Edge>) {
+        if (!_tree->_updating) {
+          return geometryOf((*_tree->_primitives)[i]);
+        }
+      }
+      return _tree->_geometries[i];
+    }
+
+  private:
+    const UpdatableRTree *_tree;
+  };
+
+  using RTree = bgi::rtree<typename Traits::IndexType, impl::RTreeParameters, IndexGetter>;
+  using Ptr   = std::shared_ptr<RTree>;
+
+  UpdatableRTree() = default;
+
+  // The getters of the tree refer to this object
+  UpdatableRTree(const UpdatableRTree &) = delete;
+  UpdatableRTree &operator=(const UpdatableRTree &) = delete;
+
+  /// Returns the rtree, which is built or updated first if required
+  const Ptr &get(const typename Traits::MeshContainer &primitives, const std::string &kind, const std::string &meshName)
+  {
+    if (_tree && _outdated) {
+      update(primitives, kind, meshName);
+    }
+    if (!_tree) {
+      build(primitives, kind, meshName);
+    }
+    return _tree;
+  }
+
+  /// Marks the rtree as outdated, which compares it to the primitives on the next access
+  void markOutdated()
+  {
+    _outdated = true;
+  }
+
+  /// Releases the rtree and the snapshot
+  void reset()
+  {
+    _primitives = nullptr;
+    _geometries = {};
+    _tree.reset();
+    _outdated = false;
+    _updated  = 0;
+  }
+
+private:
+  const typename Traits::MeshContainer *_primitives = nullptr;
+
+  typename Traits::GeometryContainer _geometries;
+
+  Ptr _tree;
+
+  bool _outdated = false;
+
+  bool _updating = false;
+
+  /// Amount of updated primitives since the tree was bulk-loaded
+  std::size_t _updated = 0;
+
+  void build(const typename Traits::MeshContainer &primitives, const std::string &kind, const std::string &meshName)
+  {
+    precice::profiling::Event e("query.index.get" + kind + "IndexTree." + meshName);
+
+    _primitives = &primitives;
+    _geometries.clear();
+    _geometries.reserve(primitives.size());
+    for (const auto &primitive : primitives) {
+      _geometries.push_back(geometryOf(primitive));
+    }
+
+    // Generating the rtree is expensive, so passing everything in the ctor is
+    // the best we can do. Even passing an index range instead of calling
+    // tree->insert repeatedly is about 10x faster.
+    impl::RTreeParameters params;
+    IndexGetter           ind(*this);
+    _tree = std::make_shared<RTree>(boost::irange<std::size_t>(0lu, primitives.size()), params, ind);
+
+    _outdated = false;
+    _updated  = 0;
+  }
+
+  /// Updates the changed primitives in the tree or resets the tree if too many changed
+  void update(const typename Traits::MeshContainer &primitives, const std::string &kind, const std::string &meshName)
+  {
+    _outdated = false;
+
+    const std::size_t        kept = std::min(_geometries.size(), primitives.size());
+    std::vector<std::size_t> moved;
+    for (std::size_t i = 0; i < kept; ++i) {
+      if (keyOf(_geometries[i]) != keyOf(geometryOf(primitives[i]))) {
+        moved.push_back(i);
+      }
+    }
+    const std::size_t updated = moved.size() + std::max(_geometries.size(), primitives.size()) - kept;
+    if (updated == 0) {
+      return;
+    }
+    if (static_cast<double>(_updated + updated) > maxUpdatedFraction * static_cast<double>(primitives.size()) || isReordered(primitives, moved, kept)) {
+      _tree.reset();
+      return;
+    }
+
+    precice::profiling::Event e("query.index.update" + kind + "IndexTree." + meshName);
+    _primitives = &primitives;
+    _updating   = true;
+    for (auto i : moved) {
+      [[maybe_unused]] const auto removed = _tree->remove(i);
+      PRECICE_ASSERT(removed == 1, i);
+      _geometries[i] = geometryOf(primitives[i]);
+      _tree->insert(i);
+    }
+    for (std::size_t i = kept; i < _geometries.size(); ++i) {
+      [[maybe_unused]] const auto removed = _tree->remove(i);
+      PRECICE_ASSERT(removed == 1, i);
+    }
+    _geometries.resize(kept);
+    for (std::size_t i = kept; i < primitives.size(); ++i) {
+      _geometries.push_back(geometryOf(primitives[i]));
+      _tree->insert(i);
+    }
+    _updating = false;
+    _updated += updated;
+    PRECICE_ASSERT(_tree->size() == primitives.size(), _tree->size(), primitives.size());
+  }
+
+  /// Checks whether an updated primitive takes the old geometry of another updated primitive, which indicates reordered primitives
+  bool isReordered(const typename Traits::MeshContainer &primitives, const std::vector<std::size_t> &moved, std::size_t kept) const
+  {
+    std::vector<GeometryKey> oldKeys;
+    oldKeys.reserve(moved.size() + _geometries.size() - kept);
+    for (auto i : moved) {
+      oldKeys.push_back(keyOf(_geometries[i]));
+    }
+    for (std::size_t i = kept; i < _geometries.size(); ++i) {
+      oldKeys.push_back(keyOf(_geometries[i]));
+    }
+    std::sort(oldKeys.begin(), oldKeys.end());
+
+    const auto takesOldGeometry = [&](std::size_t i) {
+      return std::binary_search(oldKeys.begin(), oldKeys.end(), keyOf(geometryOf(primitives[i])));
+    };
+    if (std::any_of(moved.begin(), moved.end(), takesOldGeometry)) {
+      return true;
+    }
+    for (std::size_t i = kept; i < primitives.size(); ++i) {
+      if (takesOldGeometry(i)) {
+        return true;
+      }
+    }
+    return false;
+  }
 };
 
+} // namespace
+
+using VertexRTree      = UpdatableRTree<mesh::Vertex>;
+using EdgeRTree        = UpdatableRTree<mesh::Edge>;
+using TriangleRTree    = UpdatableRTree<mesh::Triangle>;
+using TetrahedronRTree = UpdatableRTree<mesh::Tetrahedron>;
+
+/// Index backend using boost::geometry::index::rtree
 class Index::IndexImpl {
 public:
-  VertexTraits::Ptr      getVertexRTree(const mesh::Mesh &mesh);
-  EdgeTraits::Ptr        getEdgeRTree(const mesh::Mesh &mesh);
-  TriangleTraits::Ptr    getTriangleRTree(const mesh::Mesh &mesh);
-  TetrahedronTraits::Ptr getTetraRTree(const mesh::Mesh &mesh);
+  const VertexRTree::Ptr &getVertexRTree(const mesh::Mesh &mesh)
+  {
+    return _vertexTree.get(mesh.vertices(), "Vertex", mesh.getName());
+  }
+
+  const EdgeRTree::Ptr &getEdgeRTree(const mesh::Mesh &mesh)
+  {
+    return _edgeTree.get(mesh.edges(), "Edge", mesh.getName());
+  }
+
+  const TriangleRTree::Ptr &getTriangleRTree(const mesh::Mesh &mesh)
+  {
+    return _triangleTree.get(mesh.triangles(), "Triangle", mesh.getName());
+  }
+
+  const TetrahedronRTree::Ptr &getTetraRTree(const mesh::Mesh &mesh)
+  {
+    return _tetraTree.get(mesh.tetrahedra(), "Tetra", mesh.getName());
+  }
+
+  template <typename Out>
+  void closestVertices(const mesh::Mesh &mesh, const Eigen::VectorXd &location, int n, Out &&out)
+  {
+    getVertexRTree(mesh)->query(bgi::nearest(location, n), boost::make_function_output_iterator([&](size_t matchID) {
+                                  out(matchID);
+                                }));
+  }
+
+  template <typename Out>
+  void closestEdges(const mesh::Mesh &mesh, const Eigen::VectorXd &location, int n, Out &&out)
+  {
+    getEdgeRTree(mesh)->query(bgi::nearest(location, n), boost::make_function_output_iterator([&](size_t matchID) {
+                                out(matchID);
+                              }));
+  }
 
-  void clear();
+  template <typename Out>
+  void closestTriangles(const mesh::Mesh &mesh, const Eigen::VectorXd &location, int n, Out &&out)
+  {
+    getTriangleRTree(mesh)->query(bgi::nearest(location, n), boost::make_function_output_iterator([&](size_t matchID) {
+                                    out(matchID);
+                                  }));
+  }
+
+  template <typename Visit>
+  bool visitVerticesInsideBox(const mesh::Mesh &mesh, const RTreeBox &box, Visit &&visit)
+  {
+    const auto &rtree = getVertexRTree(mesh);
+    for (auto iter = rtree->qbegin(bgi::intersects(box)); iter != rtree->qend(); ++iter) {
+      if (visit(*iter)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  template <typename Out>
+  void enclosingTetrahedra(const mesh::Mesh &mesh, const Eigen::VectorXd &location, Out &&out)
+  {
+    getTetraRTree(mesh)->query(bgi::covers(location), boost::make_function_output_iterator([&](size_t matchID) {
+                                 out(matchID);
+                               }));
+  }
+
+  RTreeBox vertexBounds(const mesh::Mesh &mesh)
+  {
+    const auto bounds = getVertexRTree(mesh)->bounds();
+    return makeBox(mesh::Vertex::RawCoords{bg::get<bg::min_corner, 0>(bounds), bg::get<bg::min_corner, 1>(bounds), bg::get<bg::min_corner, 2>(bounds)},
+                   mesh::Vertex::RawCoords{bg::get<bg::max_corner, 0>(bounds), bg::get<bg::max_corner, 1>(bounds), bg::get<bg::max_corner, 2>(bounds)});
+  }
+
+  void buildVertexTree(const mesh::Mesh &mesh)
+  {
+    getVertexRTree(mesh);
+  }
+
+  void buildTrees(const mesh::Mesh &mesh)
+  {
+    getVertexRTree(mesh);
+    getEdgeRTree(mesh);
+    getTriangleRTree(mesh);
+    getTetraRTree(mesh);
+  }
+
+  void clear()
+  {
+    _vertexTree.reset();
+    _edgeTree.reset();
+    _triangleTree.reset();
+    _tetraTree.reset();
+  }
+
+  /// Keeps the trees, which are updated on their next access
+  void markOutdated()
+  {
+    _vertexTree.markOutdated();
+    _edgeTree.markOutdated();
+    _triangleTree.markOutdated();
+    _tetraTree.markOutdated();
+  }
 
 private:
-  MeshIndices indices;
+  VertexRTree      _vertexTree;
+  EdgeRTree        _edgeTree;
+  TriangleRTree    _triangleTree;
+  TetrahedronRTree _tetraTree;
 };
 
-VertexTraits::Ptr Index::IndexImpl::getVertexRTree(const mesh::Mesh &mesh)
+#else
+
+namespace {
+
+using PackedBox = impl::PackedRTree::Box;
+
+/// Returns the box of a primitive spanned by its first N vertices
+template <int N, typename Primitive>
+PackedBox envelope(const Primitive &primitive)
 {
-  if (indices.vertexRTree) {
-    return indices.vertexRTree;
+  PackedBox box{primitive.vertex(0).rawCoords(), primitive.vertex(0).rawCoords()};
+  for (int i = 1; i < N; ++i) {
+    const auto &coords = primitive.vertex(i).rawCoords();
+    for (std::size_t d = 0; d < 3; ++d) {
+      box.min[d] = std::min(box.min[d], coords[d]);
+      box.max[d] = std::max(box.max[d], coords[d]);
+    }
   }
+  return box;
+}
 
-  precice::profiling::Event e("query.index.getVertexIndexTree." + mesh.getName());
+double squaredDistance(const mesh::Vertex::RawCoords &lhs, const mesh::Vertex::RawCoords &rhs)
+{
+  return math::pow_int<2>(lhs[0] - rhs[0]) + math::pow_int<2>(lhs[1] - rhs[1]) + math::pow_int<2>(lhs[2] - rhs[2]);
+}
 
-  // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do. Even passing an index range instead of calling
-  // tree->insert repeatedly is about 10x faster.
-  impl::RTreeParameters     params;
-  VertexTraits::IndexGetter ind(mesh.vertices());
-  auto                      tree = std::make_shared<VertexTraits::RTree>(
-      boost::irange<std::size_t>(0lu, mesh.nVertices()), params, ind);
+/// Returns the squared distance of a point to the segment between a and b
+double squaredSegmentDistance(const mesh::Vertex::RawCoords &point, const mesh::Vertex::RawCoords &a, const mesh::Vertex::RawCoords &b)
+{
+  double projection = 0.0;
+  double length     = 0.0;
+  for (std::size_t d = 0; d < 3; ++d) {
+    projection += (point[d] - a[d]) * (b[d] - a[d]);
+    length += (b[d] - a[d]) * (b[d] - a[d]);
+  }
+  const double t = length > 0.0 ? std::clamp(projection / length, 0.0, 1.0) : 0.0;
 
-  indices.vertexRTree = std::move(tree);
-  return indices.vertexRTree;
+  mesh::Vertex::RawCoords closest;
+  for (std::size_t d = 0; d < 3; ++d) {
+    closest[d] = a[d] + t * (b[d] - a[d]);
+  }
+  return squaredDistance(point, closest);
 }
 
-EdgeTraits::Ptr Index::IndexImpl::getEdgeRTree(const mesh::Mesh &mesh)
+/// Bulk-loads a packed tree with the boxes of the given primitives
+template <typename Container, typename Envelope>
+impl::PackedRTree buildPackedTree(const Container &primitives, Envelope &&envelope)
 {
-  if (indices.edgeRTree) {
-    return indices.edgeRTree;
+  std::vector<PackedBox> boxes;
+  boxes.reserve(primitives.size());
+  for (const auto &primitive : primitives) {
+    boxes.push_back(envelope(primitive));
   }
+  return impl::PackedRTree(boxes);
+}
+
+} // namespace
 
-  precice::profiling::Event e("query.index.getEdgeIndexTree." + mesh.getName());
+/// Index backend using static packed R-trees, see impl::PackedRTree
+class Index::IndexImpl {
+public:
+  template <typename Out>
+  void closestVertices(const mesh::Mesh &mesh, const Eigen::VectorXd &location, int n, Out &&out)
+  {
+    const auto point = eigenToRaw(location);
+    for (auto matchID : getVertexTree(mesh).nearest(point, n, [&](std::size_t i) { return squaredDistance(point, mesh.vertex(i).rawCoords()); })) {
+      out(matchID);
+    }
+  }
 
-  // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do. Even passing an index range instead of calling
-  // tree->insert repeatedly is about 10x faster.
-  impl::RTreeParameters   params;
-  EdgeTraits::IndexGetter ind(mesh.edges());
+  template <typename Out>
+  void closestEdges(const mesh::Mesh &mesh, const Eigen::VectorXd &location, int n, Out &&out)
+  {
+    const auto point = eigenToRaw(location);
+    for (auto matchID : getEdgeTree(mesh).nearest(point, n, [&](std::size_t i) {
+           const auto &edge = mesh.edges()[i];
+           return squaredSegmentDistance(point, edge.vertex(0).rawCoords(), edge.vertex(1).rawCoords());
+         })) {
+      out(matchID);
+    }
+  }
 
-  auto tree = std::make_shared<EdgeTraits::RTree>(
-      boost::irange<std::size_t>(0lu, mesh.edges().size()), params, ind);
+  /// Like the boost backend, triangles are ranked by the distance to their boxes
+  template <typename Out>
+  void closestTriangles(const mesh::Mesh &mesh, const Eigen::VectorXd &location, int n, Out &&out)
+  {
+    const auto point = eigenToRaw(location);
+    for (auto matchID : getTriangleTree(mesh).nearest(point, n, [&](std::size_t i) { return impl::PackedRTree::squaredDistance(point, envelope<3>(mesh.triangles()[i])); })) {
+      out(matchID);
+    }
+  }
 
-  indices.edgeRTree = std::move(tree);
-  return indices.edgeRTree;
-}
+  template <typename Visit>
+  bool visitVerticesInsideBox(const mesh::Mesh &mesh, const RTreeBox &box, Visit &&visit)
+  {
+    return getVertexTree(mesh).visitIntersecting({box.min_corner(), box.max_corner()}, visit);
+  }
 
-TriangleTraits::Ptr Index::IndexImpl::getTriangleRTree(const mesh::Mesh &mesh)
-{
-  if (indices.triangleRTree) {
-    return indices.triangleRTree;
+  template <typename Out>
+  void enclosingTetrahedra(const mesh::Mesh &mesh, const Eigen::VectorXd &location, Out &&out)
+  {
+    const auto point = eigenToRaw(location);
+    getTetraTree(mesh).visitIntersecting({point, point}, [&](std::size_t matchID) {
+      out(matchID);
+      return false;
+    });
   }
 
-  precice::profiling::Event e("query.index.getTriangleIndexTree." + mesh.getName());
+  RTreeBox vertexBounds(const mesh::Mesh &mesh)
+  {
+    const auto &bounds = getVertexTree(mesh).bounds();
+    return makeBox(bounds.min, bounds.max);
+  }
 
-  // We first generate the values for the triangle rtree.
-  // The resulting vector is a random access range, which can be passed to the
-  // constructor of the rtree for more efficient indexing.
-  std::vector<TriangleTraits::IndexType> elements;
-  elements.reserve(mesh.triangles().size());
-  for (size_t i = 0; i < mesh.triangles().size(); ++i) {
-    auto box = bg::return_envelope<RTreeBox>(mesh.triangles()[i]);
-    elements.emplace_back(std::move(box), i);
+  void buildVertexTree(const mesh::Mesh &mesh)
+  {
+    getVertexTree(mesh);
   }
 
-  // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do.
-  impl::RTreeParameters       params;
-  TriangleTraits::IndexGetter ind;
+  void buildTrees(const mesh::Mesh &mesh)
+  {
+    getVertexTree(mesh);
+    getEdgeTree(mesh);
+    getTriangleTree(mesh);
+    getTetraTree(mesh);
+  }
 
-  auto tree             = std::make_shared<TriangleTraits::RTree>(elements, params, ind);
-  indices.triangleRTree = std::move(tree);
-  return indices.triangleRTree;
-}
+  void clear()
+  {
+    _vertexTree.reset();
+    _edgeTree.reset();
+    _triangleTree.reset();
+    _tetraTree.reset();
+  }
 
-TetrahedronTraits::Ptr Index::IndexImpl::getTetraRTree(const mesh::Mesh &mesh)
-{
-  if (indices.tetraRTree) {
-    return indices.tetraRTree;
+  /// The packed trees are static, hence, they are rebuilt on their next access
+  void markOutdated()
+  {
+    clear();
   }
 
-  precice::profiling::Event e("query.index.getTetraIndexTree." + mesh.getName());
+private:
+  std::optional<impl::PackedRTree> _vertexTree;
+  std::optional<impl::PackedRTree> _edgeTree;
+  std::optional<impl::PackedRTree> _triangleTree;
+  std::optional<impl::PackedRTree> _tetraTree;
+
+  const impl::PackedRTree &getVertexTree(const mesh::Mesh &mesh)
+  {
+    if (!_vertexTree) {
+      precice::profiling::Event e("query.index.getVertexIndexTree." + mesh.getName());
+      _vertexTree = buildPackedTree(mesh.vertices(), [](const mesh::Vertex &v) { return PackedBox{v.rawCoords(), v.rawCoords()}; });
+    }
+    return *_vertexTree;
+  }
 
-  // We first generate the values for the tetra rtree.
-  // The resulting vector is a random access range, which can be passed to the
-  // constructor of the rtree for more efficient indexing.
-  std::vector<TetrahedronTraits::IndexType> elements;
-  elements.reserve(mesh.tetrahedra().size());
-  for (size_t i = 0; i < mesh.tetrahedra().size(); ++i) {
-    // We use a custom function to compute the AABB, because
-    // bg::return_envelope was designed for polygons.
-    auto box = makeBox(mesh.tetrahedra()[i]);
-    elements.emplace_back(std::move(box), i);
+  const impl::PackedRTree &getEdgeTree(const mesh::Mesh &mesh)
+  {
+    if (!_edgeTree) {
+      precice::profiling::Event e("query.index.getEdgeIndexTree." + mesh.getName());
+      _edgeTree = buildPackedTree(mesh.edges(), envelope<2, mesh::Edge>);
+    }
+    return *_edgeTree;
   }
 
-  // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do.
-  impl::RTreeParameters          params;
-  TetrahedronTraits::IndexGetter ind;
+  const impl::PackedRTree &getTriangleTree(const mesh::Mesh &mesh)
+  {
+    if (!_triangleTree) {
+      precice::profiling::Event e("query.index.getTriangleIndexTree." + mesh.getName());
+      _triangleTree = buildPackedTree(mesh.triangles(), envelope<3, mesh::Triangle>);
+    }
+    return *_triangleTree;
+  }
 
-  auto tree          = std::make_shared<TetrahedronTraits::RTree>(elements, params, ind);
-  indices.tetraRTree = std::move(tree);
-  return indices.tetraRTree;
-}
+  const impl::PackedRTree &getTetraTree(const mesh::Mesh &mesh)
+  {
+    if (!_tetraTree) {
+      precice::profiling::Event e("query.index.getTetraIndexTree." + mesh.getName());
+      _tetraTree = buildPackedTree(mesh.tetrahedra(), envelope<4, mesh::Tetrahedron>);
+    }
+    return *_tetraTree;
+  }
+};
 
-void Index::IndexImpl::clear()
-{
-  indices.vertexRTree.reset();
-  indices.edgeRTree.reset();
-  indices.triangleRTree.reset();
-  indices.tetraRTree.reset();
-}
+#endif // PRECICE_PACKED_INDEX
+
+/**
+ * @brief Uniform grids of the vertices, which serve the fixed-radius queries
+ *
+ * The cell width of a grid is the smallest power of two not below the query radius, such that queries of similar
+ * radii share a grid. As small radii on sparse meshes lead to mostly empty cells, the cells are widened until there
+ * are at most maxCellsPerVertex cells per vertex. Grids are built on first use. Unlike the index trees, this is safe
+ * for concurrent fixed-radius queries, which then wait for the build. Index::buildVertexGrids() builds them beforehand.
+ */
+class Index::GridCache {
+public:
+  const impl::VertexGrid &get(const mesh::Mesh &mesh, double radius)
+  {
+    PRECICE_ASSERT(radius > 0, radius);
+    {
+      std::shared_lock lock(_mutex);
+      if (_levels) {
+        if (auto grid = _grids.find(getLevel(radius)); grid != _grids.end()) {
+          return grid->second;
+        }
+      }
+    }
+
+    // The grid is missing, only one thread builds it. References to the elements of the map remain valid on insertion.
+    std::unique_lock lock(_mutex);
+    if (!_levels) {
+      _levels = computeLevels(mesh);
+    }
+    const int level = getLevel(radius);
+    auto      grid  = _grids.find(level);
+    if (grid == _grids.end()) {
+      precice::profiling::Event            e("query.index.getVertexGrid." + mesh.getName());
+      const auto                           coordinates = mesh.vertexCoordinates();
+      std::vector<impl::VertexGrid::Point> points(coordinates.cols(), impl::VertexGrid::Point{});
+      for (Eigen::Index i = 0; i < coordinates.cols(); ++i) {
+        std::copy_n(coordinates.col(i).data(), coordinates.rows(), points[i].data());
+      }
+      grid = _grids.emplace(level, impl::VertexGrid(points, std::ldexp(1.0, level))).first;
+    }
+    return grid->second;
+  }
+
+  /// Requires that no queries run concurrently
+  void clear()
+  {
+    _levels.reset();
+    _grids.clear();
+  }
+
+private:
+  /// Bounds the memory of the grids, which require an offset per cell
+  static constexpr double maxCellsPerVertex = 2.0;
+
+  /// Range of the exponents of the cell widths, which is computed from the bounding box of the mesh
+  std::optional<std::pair<int, int>> _levels;
+
+  /// Grids by the exponent of their cell width
+  std::map<int, impl::VertexGrid> _grids;
+
+  /// Guards the lazy build of _levels and _grids
+  std::shared_mutex _mutex;
+
+  /// Returns the exponent of the cell width of the grid serving the given radius, requires _levels
+  int getLevel(double radius) const
+  {
+    return static_cast<int>(std::clamp(std::ceil(std::log2(radius)), static_cast<double>(_levels->first), static_cast<double>(_levels->second)));
+  }
+
+  /// Returns the exponents of the narrowest cells respecting maxCellsPerVertex and of cells spanning the bounding box
+  static std::pair<int, int> computeLevels(const mesh::Mesh &mesh)
+  {
+    if (mesh.empty()) {
+      return {0, 0};
+    }
+    impl::VertexGrid::Point lower = mesh.vertex(0).rawCoords(), upper = lower;
+    for (const auto &vertex : mesh.vertices()) {
+      const auto &coords = vertex.rawCoords();
+      for (std::size_t d = 0; d < 3; ++d) {
+        lower[d] = std::min(lower[d], coords[d]);
+        upper[d] = std::max(upper[d], coords[d]);
+      }
+    }
+    impl::VertexGrid::Point extents;
+    for (std::size_t d = 0; d < 3; ++d) {
+      extents[d] = upper[d] - lower[d];
+    }
+    const double maxExtent = *std::max_element(extents.begin(), extents.end());
+    if (maxExtent == 0.0) {
+      return {0, 0};
+    }
+
+    const int    maxLevel = static_cast<int>(std::ceil(std::log2(maxExtent)));
+    const double maxCells = maxCellsPerVertex * mesh.nVertices();
+    int          minLevel = maxLevel;
+    while (impl::VertexGrid::requiredCells(extents, std::ldexp(1.0, minLevel - 1)) <= maxCells) {
+      --minLevel;
+    }
+    return {minLevel, maxLevel};
+  }
+};
 
 //
 // query::Index
@@ -156,13 +774,15 @@ void Index::IndexImpl::clear()
 Index::Index(mesh::PtrMesh mesh)
     : _mesh(mesh.get())
 {
-  _pimpl = std::make_unique<IndexImpl>(IndexImpl{});
+  _pimpl = std::make_unique<IndexImpl>();
+  _grids = std::make_unique<GridCache>();
 }
 
 Index::Index(mesh::Mesh &mesh)
     : _mesh(&mesh)
 {
-  _pimpl = std::make_unique<IndexImpl>(IndexImpl{});
+  _pimpl = std::make_unique<IndexImpl>();
+  _grids = std::make_unique<GridCache>();
 }
 
 // Required for the pimpl idiom to work with std::unique_ptr
@@ -174,101 +794,137 @@ VertexMatch Index::getClosestVertex(const Eigen::VectorXd &sourceCoord)
 
   PRECICE_ASSERT(not _mesh->empty(), _mesh->getName());
   VertexMatch match;
-  const auto &rtree = _pimpl->getVertexRTree(*_mesh);
-  rtree->query(bgi::nearest(sourceCoord, 1), boost::make_function_output_iterator([&](size_t matchID) {
-                 match = VertexMatch(matchID);
-               }));
+  _pimpl->closestVertices(*_mesh, sourceCoord, 1, [&](std::size_t matchID) {
+    match = VertexMatch(matchID);
+  });
   return match;
 }
 
+std::vector<VertexID> Index::getClosestVertexBatch(const Eigen::Ref<const Eigen::MatrixXd> &locations, unsigned int nThreads)
+{
+  PRECICE_TRACE(locations.cols(), nThreads);
+  std::vector<VertexID> matches(locations.cols());
+  if (matches.empty()) {
+    return matches;
+  }
+
+  PRECICE_ASSERT(not _mesh->empty(), _mesh->getName());
+  PRECICE_ASSERT(locations.rows() == _mesh->getDimensions(), locations.rows(), _mesh->getDimensions());
+
+  _pimpl->buildVertexTree(*_mesh);
+  forEachLocation(locations, utils::chunkCount(matches.size(), minQueriesPerThread, nThreads), [&](std::size_t, std::size_t column, const Eigen::VectorXd &location) {
+    _pimpl->closestVertices(*_mesh, location, 1, [&](std::size_t matchID) {
+      matches[column] = matchID;
+    });
+  });
+  return matches;
+}
+
 std::vector<VertexID> Index::getClosestVertices(const Eigen::VectorXd &sourceCoord, int n)
 {
   PRECICE_TRACE();
   PRECICE_ASSERT(!(_mesh->empty()), _mesh->getName());
   std::vector<VertexID> matches;
-  const auto &          rtree = _pimpl->getVertexRTree(*_mesh);
-
-  rtree->query(bgi::nearest(sourceCoord, n), boost::make_function_output_iterator([&](size_t matchID) {
-                 matches.emplace_back(matchID);
-               }));
+  _pimpl->closestVertices(*_mesh, sourceCoord, n, [&](std::size_t matchID) {
+    matches.emplace_back(matchID);
+  });
   return matches;
 }
 
+BatchMatches Index::getClosestVerticesBatch(const Eigen::Ref<const Eigen::MatrixXd> &locations, int n, unsigned int nThreads)
+{
+  PRECICE_TRACE(locations.cols(), n, nThreads);
+  if (locations.cols() == 0) {
+    return {};
+  }
+  PRECICE_ASSERT(not _mesh->empty(), _mesh->getName());
+  PRECICE_ASSERT(locations.rows() == _mesh->getDimensions(), locations.rows(), _mesh->getDimensions());
+
+  _pimpl->buildVertexTree(*_mesh);
+  return gatherLocations(locations, nThreads, [&](const Eigen::VectorXd &location, std::vector<VertexID> &ids) {
+    _pimpl->closestVertices(*_mesh, location, n, [&](std::size_t matchID) {
+      ids.push_back(matchID);
+    });
+  });
+}
+
 std::vector<EdgeMatch> Index::getClosestEdges(const Eigen::VectorXd &sourceCoord, int n)
 {
   PRECICE_TRACE();
 
-  const auto &rtree = _pimpl->getEdgeRTree(*_mesh);
-
   std::vector<EdgeMatch> matches;
-  rtree->query(bgi::nearest(sourceCoord, n), boost::make_function_output_iterator([&](size_t matchID) {
-                 matches.emplace_back(matchID);
-               }));
+  _pimpl->closestEdges(*_mesh, sourceCoord, n, [&](std::size_t matchID) {
+    matches.emplace_back(matchID);
+  });
   return matches;
 }
 
 std::vector<TriangleMatch> Index::getClosestTriangles(const Eigen::VectorXd &sourceCoord, int n)
 {
   PRECICE_TRACE();
-  const auto &rtree = _pimpl->getTriangleRTree(*_mesh);
-
   std::vector<TriangleMatch> matches;
-  rtree->query(bgi::nearest(sourceCoord, n),
-               boost::make_function_output_iterator([&](TriangleTraits::IndexType const &match) {
-                 matches.emplace_back(match.second);
-               }));
+  _pimpl->closestTriangles(*_mesh, sourceCoord, n, [&](std::size_t matchID) {
+    matches.emplace_back(matchID);
+  });
   return matches;
 }
 
 std::vector<VertexID> Index::getVerticesInsideBox(const mesh::Vertex &centerVertex, double radius)
 {
   PRECICE_TRACE();
-
-  // Prepare boost::geometry box
-  auto coords    = centerVertex.getCoords();
-  auto searchBox = query::makeBox(coords.array() - radius, coords.array() + radius);
-
-  const auto &          rtree = _pimpl->getVertexRTree(*_mesh);
   std::vector<VertexID> matches;
-  rtree->query(bgi::intersects(searchBox) and bg::index::satisfies([&](size_t const i) { return bg::distance(centerVertex, _mesh->vertex(i)) < radius; }),
-               std::back_inserter(matches));
+  if (radius > 0) {
+    _grids->get(*_mesh, radius).visitInsideSphere(centerVertex.rawCoords(), radius, [&](std::size_t i) {
+      matches.push_back(i);
+      return false;
+    });
+  }
   return matches;
 }
 
 bool Index::isAnyVertexInsideBox(const mesh::Vertex &centerVertex, double radius)
 {
   PRECICE_TRACE();
-
-  // Prepare boost::geometry box
-  auto coords    = centerVertex.getCoords();
-  auto searchBox = query::makeBox(coords.array() - radius, coords.array() + radius);
-
-  const auto &rtree = _pimpl->getVertexRTree(*_mesh);
-
-  auto queryIter = rtree->qbegin(bgi::intersects(searchBox) and bg::index::satisfies([&](size_t const i) { return bg::distance(centerVertex, _mesh->vertex(i)) < radius; }));
-  bool hasMatch  = queryIter != rtree->qend();
-  return hasMatch;
+  return radius > 0 && _grids->get(*_mesh, radius).visitInsideSphere(centerVertex.rawCoords(), radius, [](std::size_t) { return true; });
 }
 
 std::vector<VertexID> Index::getVerticesInsideBox(const mesh::BoundingBox &bb)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  const auto &          rtree = _pimpl->getVertexRTree(*_mesh);
   std::vector<VertexID> matches;
-  rtree->query(bgi::intersects(query::makeBox(bb.minCorner(), bb.maxCorner())), std::back_inserter(matches));
+  _pimpl->visitVerticesInsideBox(*_mesh, query::makeBox(bb.minCorner(), bb.maxCorner()), [&](std::size_t i) {
+    matches.push_back(i);
+    return false;
+  });
   return matches;
 }
 
+BatchMatches Index::getVerticesInsideBoxBatch(const Eigen::Ref<const Eigen::MatrixXd> &centers, double radius, unsigned int nThreads)
+{
+  PRECICE_TRACE(centers.cols(), radius, nThreads);
+  PRECICE_ASSERT(centers.cols() == 0 || centers.rows() == _mesh->getDimensions(), centers.rows(), _mesh->getDimensions());
+
+  if (!(radius > 0)) {
+    BatchMatches matches;
+    matches.offsets.assign(centers.cols() + 1, 0);
+    return matches;
+  }
+  const auto &grid = _grids->get(*_mesh, radius);
+  return gatherLocations(centers, nThreads, [&](const Eigen::VectorXd &center, std::vector<VertexID> &ids) {
+    grid.visitInsideSphere(eigenToRaw(center), radius, [&](std::size_t i) {
+      ids.push_back(i);
+      return false;
+    });
+  });
+}
+
 std::vector<TetrahedronID> Index::getEnclosingTetrahedra(const Eigen::VectorXd &location)
 {
   PRECICE_TRACE();
-  const auto &rtree = _pimpl->getTetraRTree(*_mesh);
-
   std::vector<TetrahedronID> matches;
-  rtree->query(bgi::covers(location), boost::make_function_output_iterator([&](TetrahedronTraits::IndexType const &match) {
-                 matches.emplace_back(match.second);
-               }));
+  _pimpl->enclosingTetrahedra(*_mesh, location, [&](std::size_t matchID) {
+    matches.emplace_back(matchID);
+  });
   return matches;
 }
 
@@ -309,6 +965,24 @@ ProjectionMatch Index::findCellOrProjection(const Eigen::VectorXd &location, int
   }
 }
 
+std::vector<ProjectionMatch> Index::findNearestProjectionBatch(const Eigen::Ref<const Eigen::MatrixXd> &locations, int n, unsigned int nThreads)
+{
+  PRECICE_TRACE(locations.cols(), n, nThreads);
+  buildTrees();
+  return projectLocations(locations, nThreads, [&](const Eigen::VectorXd &location) {
+    return findNearestProjection(location, n);
+  });
+}
+
+std::vector<ProjectionMatch> Index::findCellOrProjectionBatch(const Eigen::Ref<const Eigen::MatrixXd> &locations, int n, unsigned int nThreads)
+{
+  PRECICE_TRACE(locations.cols(), n, nThreads);
+  buildTrees();
+  return projectLocations(locations, nThreads, [&](const Eigen::VectorXd &location) {
+    return findCellOrProjection(location, n);
+  });
+}
+
 ProjectionMatch Index::findVertexProjection(const Eigen::VectorXd &location)
 {
   auto match = getClosestVertex(location);
@@ -364,6 +1038,28 @@ ProjectionMatch Index::findTriangleProjection(const Eigen::VectorXd &location, i
   return *min;
 }
 
+void Index::buildVertexTree()
+{
+  PRECICE_TRACE();
+  _pimpl->buildVertexTree(*_mesh);
+}
+
+void Index::buildTrees()
+{
+  PRECICE_TRACE();
+  _pimpl->buildTrees(*_mesh);
+}
+
+void Index::buildVertexGrids(const std::vector<double> &radii)
+{
+  PRECICE_TRACE(radii.size());
+  for (double radius : radii) {
+    if (radius > 0) {
+      _grids->get(*_mesh, radius);
+    }
+  }
+}
+
 mesh::BoundingBox Index::getRtreeBounds()
 {
   PRECICE_TRACE();
@@ -372,18 +1068,13 @@ mesh::BoundingBox Index::getRtreeBounds()
   // we want to allow calling this function with empty meshes
   PRECICE_ASSERT(_mesh->nVertices() > 0);
 
-  auto            rtreeBox = _pimpl->getVertexRTree(*_mesh)->bounds();
+  auto            rtreeBox = _pimpl->vertexBounds(*_mesh);
   int             dim      = _mesh->getDimensions();
   Eigen::VectorXd min(dim), max(dim);
 
-  min[0] = rtreeBox.min_corner().get<0>();
-  min[1] = rtreeBox.min_corner().get<1>();
-  max[0] = rtreeBox.max_corner().get<0>();
-  max[1] = rtreeBox.max_corner().get<1>();
-
-  if (dim > 2) {
-    min[2] = rtreeBox.min_corner().get<2>();
-    max[2] = rtreeBox.max_corner().get<2>();
+  for (int d = 0; d < dim; ++d) {
+    min[d] = rtreeBox.min_corner()[d];
+    max[d] = rtreeBox.max_corner()[d];
   }
   return mesh::BoundingBox{min, max};
 }
@@ -391,6 +1082,13 @@ mesh::BoundingBox Index::getRtreeBounds()
 void Index::clear()
 {
   _pimpl->clear();
+  _grids->clear();
+}
+
+void Index::markOutdated()
+{
+  _pimpl->markOutdated();
+  _grids->clear();
 }
 
 } // namespace precice::query
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <Eigen/Core>
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -61,6 +63,28 @@ struct ProjectionMatch {
   };
 };
 
+/**
+ * @brief Flat results of a batch query returning a varying amount of vertices per location
+ *
+ * The matches of the location i are ids[offsets[i]] to ids[offsets[i + 1]].
+ */
+struct BatchMatches {
+  std::vector<std::size_t> offsets{0};
+  std::vector<VertexID>    ids;
+
+  /// Returns the amount of queried locations
+  std::size_t size() const
+  {
+    return offsets.size() - 1;
+  }
+
+  /// Returns the amount of matches of the location i
+  std::size_t count(std::size_t i) const
+  {
+    return offsets[i + 1] - offsets[i];
+  }
+};
+
 /// Class to query the index trees of the mesh
 class Index {
 
@@ -72,21 +96,43 @@ public:
   /// Get the closest vertex to the given vertex
   VertexMatch getClosestVertex(const Eigen::VectorXd &sourceCoord);
 
+  /**
+   * @brief Get the closest vertex to each of the given locations
+   *
+   * The queries are processed in Morton order and are distributed among threads.
+   *
+   * @param[in] locations the query locations as columns of a dims x n matrix
+   * @param[in] nThreads the maximal amount of threads to use, 0 uses all available hardware threads
+   * @return the IDs of the closest vertices in the order of the locations
+   */
+  std::vector<VertexID> getClosestVertexBatch(const Eigen::Ref<const Eigen::MatrixXd> &locations, unsigned int nThreads = 1);
+
   /// Get n number of closest vertices to the given vertex
   std::vector<VertexID> getClosestVertices(const Eigen::VectorXd &sourceCoord, int n);
 
+  /// Get n number of closest vertices to each of the given locations, processed like getClosestVertexBatch()
+  BatchMatches getClosestVerticesBatch(const Eigen::Ref<const Eigen::MatrixXd> &locations, int n, unsigned int nThreads = 1);
+
   /// Get n number of closest edges to the given vertex
   std::vector<EdgeMatch> getClosestEdges(const Eigen::VectorXd &sourceCoord, int n);
 
   /// Get n number of closest triangles to the given vertex
   std::vector<TriangleMatch> getClosestTriangles(const Eigen::VectorXd &sourceCoord, int n);
 
-  /// Return all the vertices inside the box formed by vertex and radius (boundary exclusive)
+  /**
+   * @brief Return all the vertices inside the box formed by vertex and radius (boundary exclusive)
+   *
+   * This and the other fixed-radius queries use a uniform grid of the vertices instead of the index tree,
+   * see impl::VertexGrid. The grids are built on demand, also by concurrent queries, or beforehand using buildVertexGrids().
+   */
   std::vector<VertexID> getVerticesInsideBox(const mesh::Vertex &centerVertex, double radius);
 
   /// Return all the vertices inside a bounding box
   std::vector<VertexID> getVerticesInsideBox(const mesh::BoundingBox &bb);
 
+  /// Return all the vertices inside the box formed by each of the given centers and radius (boundary exclusive), processed like getClosestVertexBatch()
+  BatchMatches getVerticesInsideBoxBatch(const Eigen::Ref<const Eigen::MatrixXd> &centers, double radius, unsigned int nThreads = 1);
+
   /// Returns
   bool isAnyVertexInsideBox(const mesh::Vertex &centerVertex, double radius);
 
@@ -107,16 +153,44 @@ public:
 
   ProjectionMatch findCellOrProjection(const Eigen::VectorXd &location, int n);
 
+  /// Find the closest interpolation element to each of the given locations, processed like getClosestVertexBatch()
+  std::vector<ProjectionMatch> findNearestProjectionBatch(const Eigen::Ref<const Eigen::MatrixXd> &locations, int n, unsigned int nThreads = 1);
+
+  /// Find the enclosing cell or closest interpolation element to each of the given locations, processed like getClosestVertexBatch()
+  std::vector<ProjectionMatch> findCellOrProjectionBatch(const Eigen::Ref<const Eigen::MatrixXd> &locations, int n, unsigned int nThreads = 1);
+
   // Index tree, bounds
   mesh::BoundingBox getRtreeBounds();
 
-  /// Clear the index
+  /// Builds the vertex index tree in advance, which is required before querying vertices concurrently
+  void buildVertexTree();
+
+  /// Builds the index trees of all primitives in advance, which is required before querying projections or cells concurrently
+  void buildTrees();
+
+  /// Builds the vertex grids of the given radii in advance, such that concurrent fixed-radius queries don't wait for their build
+  void buildVertexGrids(const std::vector<double> &radii);
+
+  /// Clear the index after the mesh changed, which releases all trees and grids
   void clear();
 
+  /**
+   * @brief Marks the index as outdated after the mesh was redefined, e.g., by remeshing
+   *
+   * The rtrees are kept and compared to the mesh on their next use, which updates the changed primitives in place.
+   * They are rebuilt from scratch if too many primitives changed or if the primitives were reordered.
+   * The packed rtrees and the grids are always rebuilt.
+   */
+  void markOutdated();
+
 private:
   class IndexImpl;
   std::unique_ptr<IndexImpl> _pimpl;
 
+  /// Uniform grids of the vertices for the fixed-radius queries
+  class GridCache;
+  std::unique_ptr<GridCache> _grids;
+
   /// The indexed Mesh.
   mesh::Mesh *_mesh;
 
@@ -0,0 +1,52 @@
+#include "query/impl/MortonOrder.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+namespace precice::query::impl {
+
+namespace {
+
+/// Computes the Morton code of normalized coordinates in [0, 1]
+std::uint64_t mortonCode(const Eigen::Ref<const Eigen::VectorXd> &normalized)
+{
+  const int           dims = normalized.size();
+  const int           bits = 63 / dims;
+  const std::uint64_t cells{std::uint64_t{1} << bits};
+
+  std::uint64_t code{0};
+  for (int d = 0; d < dims; ++d) {
+    const auto cell = std::min(static_cast<std::uint64_t>(normalized[d] * cells), cells - 1);
+    // Interleave the bits of all dimensions
+    for (int bit = 0; bit < bits; ++bit) {
+      code |= ((cell >> bit) & 1) << (bit * dims + d);
+    }
+  }
+  return code;
+}
+
+} // namespace
+
+std::vector<std::size_t> mortonOrder(const Eigen::Ref<const Eigen::MatrixXd> &locations)
+{
+  std::vector<std::size_t> order(locations.cols());
+  std::iota(order.begin(), order.end(), 0);
+  if (order.empty()) {
+    return order;
+  }
+
+  const Eigen::VectorXd min    = locations.rowwise().minCoeff();
+  const Eigen::VectorXd extent = (locations.rowwise().maxCoeff() - min).cwiseMax(std::numeric_limits<double>::min());
+
+  std::vector<std::uint64_t> codes(locations.cols());
+  for (Eigen::Index i = 0; i < locations.cols(); ++i) {
+    codes[i] = mortonCode((locations.col(i) - min).cwiseQuotient(extent));
+  }
+
+  std::sort(order.begin(), order.end(), [&codes](std::size_t lhs, std::size_t rhs) { return codes[lhs] < codes[rhs]; });
+  return order;
+}
+
+} // namespace precice::query::impl
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <vector>
+
+namespace precice {
+namespace query {
+namespace impl {
+
+/**
+ * @brief Returns the order of the given locations along the Morton curve through their bounding box
+ *
+ * Processing queries in this order keeps spatially close queries together, such that they traverse
+ * the same nodes of an index tree.
+ *
+ * @param[in] locations the locations as columns of a dims x n matrix
+ * @return the column indices of the locations in Morton order
+ */
+std::vector<std::size_t> mortonOrder(const Eigen::Ref<const Eigen::MatrixXd> &locations);
+
+} // namespace impl
+} // namespace query
+} // namespace precice
@@ -0,0 +1,81 @@
+#include "query/impl/PackedRTree.hpp"
+
+#include <Eigen/Core>
+#include <limits>
+
+#include "query/impl/MortonOrder.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice::query::impl {
+
+namespace {
+
+/// Returns an empty box, which any expansion overwrites
+PackedRTree::Box emptyBox()
+{
+  constexpr double max = std::numeric_limits<double>::max();
+  return {{max, max, max}, {-max, -max, -max}};
+}
+
+void expand(PackedRTree::Box &box, const PackedRTree::Box &other)
+{
+  for (std::size_t d = 0; d < 3; ++d) {
+    box.min[d] = std::min(box.min[d], other.min[d]);
+    box.max[d] = std::max(box.max[d], other.max[d]);
+  }
+}
+
+} // namespace
+
+PackedRTree::PackedRTree(const std::vector<Box> &boxes)
+{
+  if (boxes.empty()) {
+    return;
+  }
+
+  // Items with close centers end up in the same leaf, which keeps the leaves compact
+  Eigen::Matrix3Xd centers(3, boxes.size());
+  for (std::size_t i = 0; i < boxes.size(); ++i) {
+    for (std::size_t d = 0; d < 3; ++d) {
+      centers(d, i) = 0.5 * (boxes[i].min[d] + boxes[i].max[d]);
+    }
+  }
+  _items = mortonOrder(centers);
+
+  // Reserve all levels upfront, as each level shrinks by a factor of nodeSize
+  std::size_t total = boxes.size();
+  for (std::size_t n = boxes.size(); n > 1;) {
+    n = (n + nodeSize - 1) / nodeSize;
+    total += n;
+  }
+  _boxes.reserve(total + 1);
+
+  for (auto item : _items) {
+    _boxes.push_back(boxes[item]);
+  }
+  _levels.push_back(0);
+
+  // Pack parent levels until a single root remains, there is at least one level above the items
+  do {
+    const std::size_t begin = _levels.back();
+    const std::size_t end   = _boxes.size();
+    _levels.push_back(end);
+    for (std::size_t first = begin; first < end; first += nodeSize) {
+      Box node = emptyBox();
+      for (std::size_t child = first; child < std::min(first + nodeSize, end); ++child) {
+        expand(node, _boxes[child]);
+      }
+      _boxes.push_back(node);
+    }
+  } while (_boxes.size() - _levels.back() > 1);
+  _levels.push_back(_boxes.size());
+
+  PRECICE_ASSERT(_boxes.size() - _levels[_levels.size() - 2] == 1);
+}
+
+std::size_t PackedRTree::memoryUsage() const
+{
+  return _boxes.capacity() * sizeof(Box) + _items.capacity() * sizeof(std::size_t) + _levels.capacity() * sizeof(std::size_t);
+}
+
+} // namespace precice::query::impl
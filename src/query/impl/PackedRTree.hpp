@@ -0,0 +1,204 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace precice {
+namespace query {
+namespace impl {
+
+/**
+ * @brief A static R-tree, which is bulk-loaded once and stored in flat arrays
+ *
+ * The boxes of the items are sorted along the Morton curve through their centers and packed into leaves of
+ * nodeSize items. The parent levels are packed the same way, bottom-up, until a single root remains.
+ * All boxes are stored level by level in a single array, starting with the items, such that the children of
+ * a node are contiguous and the tree requires no pointers. In contrast to boost::geometry::index::rtree,
+ * the tree cannot be modified after construction, which suits the indices of meshes that don't change.
+ */
+class PackedRTree {
+public:
+  using Point = std::array<double, 3>;
+
+  /// An axis-aligned box, where unused dimensions are zero
+  struct Box {
+    Point min;
+    Point max;
+  };
+
+  /// Maximal amount of children per node
+  static constexpr std::size_t nodeSize = 16;
+
+  PackedRTree() = default;
+
+  /// Bulk-loads the tree with an item per box, the index of a box is the ID of its item
+  explicit PackedRTree(const std::vector<Box> &boxes);
+
+  /// Returns the amount of items
+  std::size_t size() const
+  {
+    return _items.size();
+  }
+
+  bool empty() const
+  {
+    return _items.empty();
+  }
+
+  /// Returns the box containing all items, requires a non-empty tree
+  const Box &bounds() const
+  {
+    return _boxes.back();
+  }
+
+  /// Returns the amount of bytes allocated by the tree
+  std::size_t memoryUsage() const;
+
+  /**
+   * @brief Visits all items whose box intersects the given box (boundary inclusive)
+   *
+   * @param[in] visit called as visit(item) and returns true to stop the traversal
+   * @returns true if the traversal was stopped by visit
+   */
+  template <typename Visit>
+  bool visitIntersecting(const Box &box, Visit &&visit) const;
+
+  /**
+   * @brief Returns the IDs of the k closest items to the given point, ordered by increasing distance
+   *
+   * @param[in] squaredDistanceToItem computes the squared distance of the point to an item,
+   *            which must not be smaller than the squared distance of the point to the box of the item.
+   */
+  template <typename SquaredDistance>
+  std::vector<std::size_t> nearest(const Point &point, std::size_t k, SquaredDistance &&squaredDistanceToItem) const;
+
+  /// Returns the squared distance of a point to a box, which is zero inside the box
+  static double squaredDistance(const Point &point, const Box &box)
+  {
+    double distance = 0.0;
+    for (std::size_t d = 0; d < 3; ++d) {
+      const double delta = std::max({box.min[d] - point[d], 0.0, point[d] - box.max[d]});
+      distance += delta * delta;
+    }
+    return distance;
+  }
+
+  /// Checks whether two boxes intersect (boundary inclusive)
+  static bool intersects(const Box &lhs, const Box &rhs)
+  {
+    for (std::size_t d = 0; d < 3; ++d) {
+      if (lhs.min[d] > rhs.max[d] || rhs.min[d] > lhs.max[d]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  /// Boxes of all levels, the items in packed order first and the root last
+  std::vector<Box> _boxes;
+
+  /// IDs of the items in packed order
+  std::vector<std::size_t> _items;
+
+  /// Offsets of the levels in _boxes, where level 0 holds the items and the last level the root.
+  /// The last entry is the size of _boxes.
+  std::vector<std::size_t> _levels;
+
+  /// Returns the range of the children of the node at the given position of a level above the items
+  std::pair<std::size_t, std::size_t> children(std::size_t level, std::size_t position) const
+  {
+    const std::size_t begin = _levels[level - 1] + (position - _levels[level]) * nodeSize;
+    return {begin, std::min(begin + nodeSize, _levels[level])};
+  }
+};
+
+template <typename Visit>
+bool PackedRTree::visitIntersecting(const Box &box, Visit &&visit) const
+{
+  if (empty()) {
+    return false;
+  }
+
+  // Pairs of level and position of nodes to traverse
+  std::vector<std::pair<std::size_t, std::size_t>> stack{{_levels.size() - 2, _boxes.size() - 1}};
+  while (!stack.empty()) {
+    const auto [level, position] = stack.back();
+    stack.pop_back();
+    const auto [begin, end] = children(level, position);
+    for (std::size_t child = begin; child < end; ++child) {
+      if (!intersects(box, _boxes[child])) {
+        continue;
+      }
+      if (level == 1) {
+        if (visit(_items[child])) {
+          return true;
+        }
+      } else {
+        stack.emplace_back(level - 1, child);
+      }
+    }
+  }
+  return false;
+}
+
+template <typename SquaredDistance>
+std::vector<std::size_t> PackedRTree::nearest(const Point &point, std::size_t k, SquaredDistance &&squaredDistanceToItem) const
+{
+  if (empty() || k == 0) {
+    return {};
+  }
+
+  // Best-first search over the nodes, ordered by their squared distance, while the best k items are kept in a max-heap.
+  // Nodes farther away than the k-th best item cannot contribute and end the search.
+  // Items at equal distances are ranked by their ID, which makes the result independent of the packed order.
+  using Node = std::tuple<double, std::size_t, std::size_t>;
+  using Item = std::pair<double, std::size_t>;
+  std::priority_queue<Node, std::vector<Node>, std::greater<>> nodes;
+  std::vector<Item>                                            best;
+  best.reserve(k + 1);
+
+  const auto worst = [&best, k] { return best.size() < k ? std::numeric_limits<double>::max() : best.front().first; };
+
+  nodes.emplace(squaredDistance(point, bounds()), _levels.size() - 2, _boxes.size() - 1);
+  while (!nodes.empty() && std::get<0>(nodes.top()) <= worst()) {
+    const auto level    = std::get<1>(nodes.top());
+    const auto position = std::get<2>(nodes.top());
+    nodes.pop();
+    const auto [begin, end] = children(level, position);
+    for (std::size_t child = begin; child < end; ++child) {
+      if (level == 1) {
+        const Item item{squaredDistanceToItem(_items[child]), _items[child]};
+        if (best.size() < k || item < best.front()) {
+          best.push_back(item);
+          std::push_heap(best.begin(), best.end());
+          if (best.size() > k) {
+            std::pop_heap(best.begin(), best.end());
+            best.pop_back();
+          }
+        }
+      } else {
+        const double nodeDistance = squaredDistance(point, _boxes[child]);
+        if (nodeDistance <= worst()) {
+          nodes.emplace(nodeDistance, level - 1, child);
+        }
+      }
+    }
+  }
+
+  std::sort_heap(best.begin(), best.end());
+  std::vector<std::size_t> matches(best.size());
+  std::transform(best.begin(), best.end(), matches.begin(), [](const Item &item) { return item.second; });
+  return matches;
+}
+
+} // namespace impl
+} // namespace query
+} // namespace precice
@@ -2,6 +2,7 @@
 
 #include <Eigen/Core>
 #include <boost/geometry.hpp>
+#include <vector>
 #include "mesh/Edge.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/Tetrahedron.hpp"
@@ -234,28 +235,32 @@ namespace impl {
 /// The general rtree parameter type used in precice
 using RTreeParameters = boost::geometry::index::rstar<16>;
 
-/// Type trait to extract information based on the type of a Primitive
+/// Type trait to extract information based on the type of a Primitive, where the Geometry is indexed by the rtree
 template <class T>
 struct PrimitiveTraits;
 
 template <>
 struct PrimitiveTraits<pm::Vertex> {
   using MeshContainer = mesh::Mesh::VertexContainer;
+  using Geometry      = pm::Vertex::RawCoords;
 };
 
 template <>
 struct PrimitiveTraits<mesh::Edge> {
   using MeshContainer = mesh::Mesh::EdgeContainer;
+  using Geometry      = boost::geometry::model::segment<pm::Vertex::RawCoords>;
 };
 
 template <>
 struct PrimitiveTraits<mesh::Triangle> {
   using MeshContainer = mesh::Mesh::TriangleContainer;
+  using Geometry      = RTreeBox;
 };
 
 template <>
 struct PrimitiveTraits<mesh::Tetrahedron> {
   using MeshContainer = mesh::Mesh::TetraContainer;
+  using Geometry      = RTreeBox;
 };
 
 /// Makes a utils::PtrVector indexable and thus be usable in boost::geometry::rtree
@@ -300,57 +305,14 @@ public:
   }
 };
 
-template <typename Primitive>
-class IsDirectIndexableHelper {
-private:
-  template <typename T, typename = typename std::enable_if<
-                            std::is_same<
-                                typename boost::geometry::traits::tag<T>::type,
-                                boost::geometry::point_tag>::value,
-                            std::nullptr_t>::type>
-  static std::true_type test(char *);
-  template <typename T, typename = typename std::enable_if<
-                            std::is_same<
-                                typename boost::geometry::traits::tag<T>::type,
-                                boost::geometry::segment_tag>::value,
-                            std::nullptr_t>::type>
-  static std::true_type test(int *);
-  template <typename T, typename = typename std::enable_if<
-                            std::is_same<
-                                typename boost::geometry::traits::tag<T>::type,
-                                boost::geometry::box_tag>::value,
-                            std::nullptr_t>::type>
-  static std::true_type test(void *);
-
-  template <typename T>
-  static std::false_type test(...);
-
-public:
-  using type = decltype(test<Primitive>(nullptr));
-};
-
-template <class Primitive>
-struct IsDirectIndexable : impl::IsDirectIndexableHelper<Primitive>::type {
-};
-
 /// The type traits of a rtree based on a Primitive
 template <class Primitive>
 struct RTreeTraits {
   using MeshContainer      = typename PrimitiveTraits<Primitive>::MeshContainer;
   using MeshContainerIndex = typename MeshContainer::size_type;
-
-  using IndexType = typename std::conditional<
-      IsDirectIndexable<Primitive>::value,
-      MeshContainerIndex,
-      std::pair<RTreeBox, MeshContainerIndex>>::type;
-
-  using IndexGetter = typename std::conditional<
-      IsDirectIndexable<Primitive>::value,
-      impl::VectorIndexable<MeshContainer>,
-      boost::geometry::index::indexable<IndexType>>::type;
-
-  using RTree = boost::geometry::index::rtree<IndexType, RTreeParameters, IndexGetter>;
-  using Ptr   = std::shared_ptr<RTree>;
+  using Geometry           = typename PrimitiveTraits<Primitive>::Geometry;
+  using GeometryContainer  = std::vector<Geometry>;
+  using IndexType          = MeshContainerIndex;
 };
 
 } // namespace impl
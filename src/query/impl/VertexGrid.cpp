@@ -0,0 +1,77 @@
+#include "query/impl/VertexGrid.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "utils/assertion.hpp"
+
+namespace precice::query::impl {
+
+VertexGrid::VertexGrid(const std::vector<Point> &points, double cellWidth)
+    : _cellWidth(cellWidth)
+{
+  PRECICE_ASSERT(cellWidth > 0.0 && std::isfinite(cellWidth), cellWidth);
+  if (points.empty()) {
+    return;
+  }
+
+  Point upper;
+  _origin.fill(std::numeric_limits<double>::max());
+  upper.fill(std::numeric_limits<double>::lowest());
+  for (const auto &point : points) {
+    for (std::size_t d = 0; d < 3; ++d) {
+      _origin[d] = std::min(_origin[d], point[d]);
+      upper[d]   = std::max(upper[d], point[d]);
+    }
+  }
+  for (std::size_t d = 0; d < 3; ++d) {
+    _cells[d] = static_cast<std::size_t>((upper[d] - _origin[d]) / _cellWidth) + 1;
+  }
+
+  // Counting sort of the points by their cells, which keeps the points of a cell in the order of their IDs
+  std::vector<std::size_t> cellOf(points.size());
+  _offsets.assign(cellCount() + 1, 0);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    std::size_t cell = 0;
+    for (std::size_t d = 3; d-- > 0;) {
+      const auto position = std::min(static_cast<std::size_t>((points[i][d] - _origin[d]) / _cellWidth), _cells[d] - 1);
+      cell                = cell * _cells[d] + position;
+    }
+    cellOf[i] = cell;
+    ++_offsets[cell + 1];
+  }
+  std::partial_sum(_offsets.begin(), _offsets.end(), _offsets.begin());
+
+  _items.resize(points.size());
+  _points.resize(points.size());
+  std::vector<std::size_t> next(_offsets.begin(), _offsets.end() - 1);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const auto slot = next[cellOf[i]]++;
+    _items[slot]    = i;
+    _points[slot]   = points[i];
+  }
+}
+
+double VertexGrid::requiredCells(const Point &extents, double cellWidth)
+{
+  double cells = 1.0;
+  for (auto extent : extents) {
+    cells *= std::floor(extent / cellWidth) + 1.0;
+  }
+  return cells;
+}
+
+std::array<std::size_t, 2> VertexGrid::cellRange(std::size_t d, double lower, double upper) const
+{
+  const double first = (lower - _origin[d]) / _cellWidth;
+  const double last  = (upper - _origin[d]) / _cellWidth;
+  if (last < 0.0 || first >= static_cast<double>(_cells[d])) {
+    return {0, 0};
+  }
+  const std::size_t begin = first > 0.0 ? static_cast<std::size_t>(first) : 0;
+  const std::size_t end   = static_cast<std::size_t>(std::min(last, static_cast<double>(_cells[d] - 1))) + 1;
+  return {begin, end};
+}
+
+} // namespace precice::query::impl
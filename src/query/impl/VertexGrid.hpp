@@ -0,0 +1,121 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace precice {
+namespace query {
+namespace impl {
+
+/**
+ * @brief A uniform grid of cubic cells over the bounding box of a set of points
+ *
+ * The points are sorted by their cell, where the cells are numbered row-major with x running fastest.
+ * Hence, the points of a cell, as well as the points of a row of neighboring cells, form a contiguous range
+ * and the cell of a location is found in constant time. This suits fixed-radius searches, where the cells
+ * are at least as wide as the radius, such that a search visits at most two cells per dimension.
+ */
+class VertexGrid {
+public:
+  using Point = std::array<double, 3>;
+
+  VertexGrid() = default;
+
+  /// Sorts the given points into cells of the given width, the index of a point is the ID of its item
+  VertexGrid(const std::vector<Point> &points, double cellWidth);
+
+  /// Returns the amount of items
+  std::size_t size() const
+  {
+    return _items.size();
+  }
+
+  bool empty() const
+  {
+    return _items.empty();
+  }
+
+  double cellWidth() const
+  {
+    return _cellWidth;
+  }
+
+  /// Returns the amount of cells
+  std::size_t cellCount() const
+  {
+    return _cells[0] * _cells[1] * _cells[2];
+  }
+
+  /**
+   * @brief Visits all items whose distance to the center is smaller than the radius
+   *
+   * The items are visited by cells, in the order of their IDs within a cell.
+   *
+   * @param[in] visit called as visit(item) and returns true to stop the traversal
+   * @returns true if the traversal was stopped by visit
+   */
+  template <typename Visit>
+  bool visitInsideSphere(const Point &center, double radius, Visit &&visit) const;
+
+  /// Returns the amount of cells required to cover the given extents with cells of the given width
+  static double requiredCells(const Point &extents, double cellWidth);
+
+private:
+  /// Lower corner of the first cell
+  Point _origin{};
+
+  double _cellWidth = 1.0;
+
+  /// Amount of cells per dimension
+  std::array<std::size_t, 3> _cells{1, 1, 1};
+
+  /// Offsets of the cells in _items and _points, where the last entry is the amount of items
+  std::vector<std::size_t> _offsets;
+
+  /// IDs of the items sorted by cells
+  std::vector<std::size_t> _items;
+
+  /// Coordinates of the items sorted by cells
+  std::vector<Point> _points;
+
+  /// Returns the range of cells of a dimension touched by the interval [lower, upper], which is empty if the interval misses the grid
+  std::array<std::size_t, 2> cellRange(std::size_t d, double lower, double upper) const;
+};
+
+template <typename Visit>
+bool VertexGrid::visitInsideSphere(const Point &center, double radius, Visit &&visit) const
+{
+  if (empty() || !(radius > 0.0)) {
+    return false;
+  }
+
+  std::array<std::array<std::size_t, 2>, 3> ranges;
+  for (std::size_t d = 0; d < 3; ++d) {
+    ranges[d] = cellRange(d, center[d] - radius, center[d] + radius);
+    if (ranges[d][0] >= ranges[d][1]) {
+      return false;
+    }
+  }
+
+  for (std::size_t z = ranges[2][0]; z < ranges[2][1]; ++z) {
+    for (std::size_t y = ranges[1][0]; y < ranges[1][1]; ++y) {
+      // The cells of a row are contiguous, hence their items are a single range
+      const std::size_t row = (z * _cells[1] + y) * _cells[0];
+      for (std::size_t i = _offsets[row + ranges[0][0]]; i < _offsets[row + ranges[0][1]]; ++i) {
+        const Point &point = _points[i];
+        // Same expression as boost::geometry::distance, which keeps the results of both indices consistent
+        const double distance = std::sqrt((point[0] - center[0]) * (point[0] - center[0]) + (point[1] - center[1]) * (point[1] - center[1]) + (point[2] - center[2]) * (point[2] - center[2]));
+        if (distance < radius && visit(_items[i])) {
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+} // namespace impl
+} // namespace query
+} // namespace precice
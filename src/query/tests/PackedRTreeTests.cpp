@@ -0,0 +1,251 @@
+#include <Eigen/Core>
+#include <algorithm>
+#include <boost/geometry.hpp>
+#include <boost/iterator/function_output_iterator.hpp>
+#include <boost/range/irange.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "query/impl/PackedRTree.hpp"
+#include "query/impl/RTreeAdapter.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::query;
+using impl::PackedRTree;
+
+namespace bgi = boost::geometry::index;
+
+namespace {
+
+using Point = PackedRTree::Point;
+using Box   = PackedRTree::Box;
+
+std::vector<Box> randomBoxes(std::size_t n, double maxExtent)
+{
+  std::mt19937                           generator(42);
+  std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+  std::uniform_real_distribution<double> extent(0.0, maxExtent);
+
+  std::vector<Box> boxes(n);
+  for (auto &box : boxes) {
+    for (std::size_t d = 0; d < 3; ++d) {
+      box.min[d] = coordinate(generator);
+      box.max[d] = box.min[d] + extent(generator);
+    }
+  }
+  return boxes;
+}
+
+std::set<std::size_t> intersecting(const PackedRTree &tree, const Box &box)
+{
+  std::set<std::size_t> matches;
+  tree.visitIntersecting(box, [&](std::size_t item) {
+    matches.insert(item);
+    return false;
+  });
+  return matches;
+}
+
+/// Counts the bytes allocated by a container, which allows to compare the memory of both trees
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  std::size_t *bytes;
+
+  explicit CountingAllocator(std::size_t *b)
+      : bytes(b) {}
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &other)
+      : bytes(other.bytes) {}
+
+  T *allocate(std::size_t n)
+  {
+    *bytes += n * sizeof(T);
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T *p, std::size_t n)
+  {
+    *bytes -= n * sizeof(T);
+    std::allocator<T>{}.deallocate(p, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U> &other) const
+  {
+    return bytes == other.bytes;
+  }
+
+  template <typename U>
+  bool operator!=(const CountingAllocator<U> &other) const
+  {
+    return bytes != other.bytes;
+  }
+};
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(QueryTests)
+BOOST_AUTO_TEST_SUITE(PackedRTreeTests)
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  PRECICE_TEST(1_rank);
+  PackedRTree tree(std::vector<Box>{});
+  BOOST_TEST(tree.empty());
+  BOOST_TEST(tree.nearest({0, 0, 0}, 3, [](std::size_t) { return 0.0; }).empty());
+  BOOST_TEST(intersecting(tree, {{-1, -1, -1}, {1, 1, 1}}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(SingleItem)
+{
+  PRECICE_TEST(1_rank);
+  PackedRTree tree(std::vector<Box>{{{1, 2, 3}, {1, 2, 3}}});
+  BOOST_TEST(tree.size() == 1);
+  BOOST_TEST((tree.bounds().min == Point{1, 2, 3}));
+  BOOST_TEST(tree.nearest({0, 0, 0}, 3, [&](std::size_t) { return 14.0; }) == std::vector<std::size_t>{0});
+  BOOST_TEST(intersecting(tree, {{0, 0, 0}, {1, 2, 3}}) == std::set<std::size_t>{0});
+  BOOST_TEST(intersecting(tree, {{0, 0, 0}, {1, 2, 2.9}}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(NearestPoints)
+{
+  PRECICE_TEST(1_rank);
+  // Points, which span three levels of nodes
+  const auto        boxes = randomBoxes(5000, 0.0);
+  const PackedRTree tree(boxes);
+  BOOST_TEST(tree.size() == boxes.size());
+
+  const auto distanceTo = [&](const Point &point) {
+    return [&boxes, point](std::size_t item) { return PackedRTree::squaredDistance(point, boxes[item]); };
+  };
+
+  for (const Point &point : {Point{0, 0, 0}, Point{0.5, -0.3, 0.9}, Point{3, 3, 3}}) {
+    std::vector<std::size_t> expected(boxes.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    std::sort(expected.begin(), expected.end(), [&](std::size_t lhs, std::size_t rhs) { return distanceTo(point)(lhs) < distanceTo(point)(rhs); });
+    expected.resize(7);
+
+    BOOST_TEST(tree.nearest(point, 7, distanceTo(point)) == expected, boost::test_tools::per_element());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(IntersectingBoxes)
+{
+  PRECICE_TEST(1_rank);
+  const auto        boxes = randomBoxes(3000, 0.1);
+  const PackedRTree tree(boxes);
+
+  for (const Box &query : {Box{{-0.2, -0.2, -0.2}, {0.2, 0.2, 0.2}}, Box{{0.5, 0.5, 0.5}, {0.5, 0.5, 0.5}}, Box{{-2, -2, -2}, {2, 2, 2}}}) {
+    std::set<std::size_t> expected;
+    for (std::size_t i = 0; i < boxes.size(); ++i) {
+      if (PackedRTree::intersects(query, boxes[i])) {
+        expected.insert(i);
+      }
+    }
+    BOOST_TEST(intersecting(tree, query) == expected);
+  }
+
+  // Stopping the traversal visits a single item
+  std::size_t visited = 0;
+  BOOST_TEST(tree.visitIntersecting({{-2, -2, -2}, {2, 2, 2}}, [&](std::size_t) { return ++visited > 0; }));
+  BOOST_TEST(visited == 1);
+}
+
+/**
+ * Compares the packed tree to the boost rtree on vertices sampled from a sphere, which resembles a coupling interface.
+ * Run explicitly using: testprecice -t QueryTests/PackedRTreeTests/Benchmark --log_level=message
+ */
+BOOST_AUTO_TEST_CASE(Benchmark, *boost::unit_test::disabled())
+{
+  PRECICE_TEST(1_rank);
+  using BoostTree = bgi::rtree<std::size_t, impl::RTreeParameters, impl::VectorIndexable<mesh::Mesh::VertexContainer>,
+                               bgi::equal_to<std::size_t>, CountingAllocator<std::size_t>>;
+
+  for (std::size_t n : {10'000, 100'000, 1'000'000}) {
+    mesh::Mesh                             mesh("BenchmarkMesh", 3, testing::nextMeshID());
+    std::mt19937                           generator(42);
+    std::uniform_real_distribution<double> angle(0.0, 2 * M_PI);
+    std::uniform_real_distribution<double> height(-1.0, 1.0);
+    for (std::size_t i = 0; i < n; ++i) {
+      const double z = height(generator), phi = angle(generator), r = std::sqrt(1 - z * z);
+      mesh.createVertex(Eigen::Vector3d(r * std::cos(phi), r * std::sin(phi), z));
+    }
+    const double radius  = 3.0 / std::sqrt(static_cast<double>(n));
+    const auto   queries = std::min<std::size_t>(n, 100'000);
+
+    auto        start = std::chrono::steady_clock::now();
+    std::size_t boostBytes{0};
+    BoostTree   boostTree(boost::irange<std::size_t>(0, n), impl::RTreeParameters{}, impl::VectorIndexable<mesh::Mesh::VertexContainer>(mesh.vertices()),
+                        bgi::equal_to<std::size_t>{}, CountingAllocator<std::size_t>(&boostBytes));
+    const double boostBuild = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    std::vector<Box> boxes;
+    boxes.reserve(n);
+    for (const auto &v : mesh.vertices()) {
+      boxes.push_back({v.rawCoords(), v.rawCoords()});
+    }
+    const PackedRTree packedTree(boxes);
+    const double      packedBuild = secondsSince(start);
+
+    std::size_t boostMatches{0}, packedMatches{0};
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < queries; ++i) {
+      const Eigen::VectorXd location = mesh.vertex(i).getCoords();
+      boostTree.query(bgi::nearest(location, 8), boost::make_function_output_iterator([&](std::size_t) { ++boostMatches; }));
+    }
+    const double boostNearest = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < queries; ++i) {
+      const auto &point = mesh.vertex(i).rawCoords();
+      packedMatches += packedTree.nearest(point, 8, [&](std::size_t j) { return PackedRTree::squaredDistance(point, boxes[j]); }).size();
+    }
+    const double packedNearest = secondsSince(start);
+    BOOST_TEST(boostMatches == packedMatches);
+
+    boostMatches = packedMatches = 0;
+    start                        = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < queries; ++i) {
+      const auto &c = mesh.vertex(i).rawCoords();
+      boostTree.query(bgi::intersects(makeBox(mesh::Vertex::RawCoords{c[0] - radius, c[1] - radius, c[2] - radius}, mesh::Vertex::RawCoords{c[0] + radius, c[1] + radius, c[2] + radius})),
+                      boost::make_function_output_iterator([&](std::size_t) { ++boostMatches; }));
+    }
+    const double boostBox = secondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < queries; ++i) {
+      const auto &c = mesh.vertex(i).rawCoords();
+      packedTree.visitIntersecting({{c[0] - radius, c[1] - radius, c[2] - radius}, {c[0] + radius, c[1] + radius, c[2] + radius}}, [&](std::size_t) {
+        ++packedMatches;
+        return false;
+      });
+    }
+    const double packedBox = secondsSince(start);
+    BOOST_TEST(boostMatches == packedMatches);
+
+    BOOST_TEST_MESSAGE("n = " << n << ", " << queries << " queries");
+    BOOST_TEST_MESSAGE("  boost rtree:  build " << boostBuild << "s, memory " << boostBytes / 1024 << "KiB, 8-NN " << queries / boostNearest << "/s, box " << queries / boostBox << "/s");
+    BOOST_TEST_MESSAGE("  packed rtree: build " << packedBuild << "s, memory " << packedTree.memoryUsage() / 1024 << "KiB, 8-NN " << queries / packedNearest << "/s, box " << queries / packedBox << "/s");
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PackedRTreeTests
+BOOST_AUTO_TEST_SUITE_END() // QueryTests
@@ -19,6 +19,7 @@
 #include "query/Index.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/Threading.hpp"
 
 using namespace precice;
 using namespace precice::mesh;
@@ -170,6 +171,112 @@ BOOST_AUTO_TEST_CASE(Query3DFullVertex)
   }
 }
 
+BOOST_AUTO_TEST_CASE(Query3DVertexBatch)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 3, precice::testing::nextMeshID()));
+  for (int x = 0; x < 20; ++x) {
+    for (int y = 0; y < 20; ++y) {
+      for (int z = 0; z < 10; ++z) {
+        mesh->createVertex(Eigen::Vector3d(x, y, z));
+      }
+    }
+  }
+  Index indexTree(mesh);
+
+  // Enough locations to distribute the queries among several threads
+  Eigen::MatrixXd locations(3, mesh->nVertices());
+  for (std::size_t i = 0; i < mesh->nVertices(); ++i) {
+    locations.col(i) = mesh->vertex(i).getCoords() + Eigen::Vector3d(0.3, -0.2, 0.1);
+  }
+
+  for (unsigned int nThreads : {1, 4}) {
+    auto results = indexTree.getClosestVertexBatch(locations, nThreads);
+    BOOST_TEST_REQUIRE(results.size() == mesh->nVertices());
+    for (std::size_t i = 0; i < mesh->nVertices(); ++i) {
+      BOOST_TEST(results[i] == indexTree.getClosestVertex(locations.col(i)).index);
+    }
+  }
+
+  BOOST_TEST(indexTree.getClosestVertexBatch(Eigen::MatrixXd(3, 0)).empty());
+}
+
+BOOST_AUTO_TEST_CASE(Query3DVerticesBatch)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 3, precice::testing::nextMeshID()));
+  for (int x = 0; x < 20; ++x) {
+    for (int y = 0; y < 20; ++y) {
+      for (int z = 0; z < 10; ++z) {
+        mesh->createVertex(Eigen::Vector3d(x, y, z));
+      }
+    }
+  }
+  Index indexTree(mesh);
+
+  Eigen::MatrixXd locations(3, mesh->nVertices());
+  for (std::size_t i = 0; i < mesh->nVertices(); ++i) {
+    locations.col(i) = mesh->vertex(i).getCoords() + Eigen::Vector3d(0.3, -0.2, 0.1);
+  }
+
+  const auto toSet = [](const BatchMatches &matches, std::size_t i) {
+    return std::set<VertexID>(matches.ids.begin() + matches.offsets[i], matches.ids.begin() + matches.offsets[i + 1]);
+  };
+
+  // Query with several threads, which splits the locations into several chunks
+  auto closest = indexTree.getClosestVerticesBatch(locations, 4, 4);
+  BOOST_TEST_REQUIRE(closest.size() == mesh->nVertices());
+  for (std::size_t i = 0; i < mesh->nVertices(); ++i) {
+    BOOST_TEST(closest.count(i) == 4);
+    auto expected = indexTree.getClosestVertices(locations.col(i), 4);
+    BOOST_TEST(toSet(closest, i) == std::set<VertexID>(expected.begin(), expected.end()));
+  }
+
+  auto inside = indexTree.getVerticesInsideBoxBatch(locations, 1.2, 4);
+  BOOST_TEST_REQUIRE(inside.size() == mesh->nVertices());
+  BOOST_TEST(inside.offsets.back() == inside.ids.size());
+  for (std::size_t i = 0; i < mesh->nVertices(); ++i) {
+    auto expected = indexTree.getVerticesInsideBox(mesh::Vertex(locations.col(i), 0), 1.2);
+    BOOST_TEST(toSet(inside, i) == std::set<VertexID>(expected.begin(), expected.end()));
+  }
+
+  BOOST_TEST(indexTree.getVerticesInsideBoxBatch(Eigen::MatrixXd(3, 0), 1.0).size() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(QueryWithBoxConcurrent)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 3, precice::testing::nextMeshID()));
+  for (int x = 0; x < 10; ++x) {
+    for (int y = 0; y < 10; ++y) {
+      for (int z = 0; z < 10; ++z) {
+        mesh->createVertex(Eigen::Vector3d(x, y, z));
+      }
+    }
+  }
+  // Radii of different grid levels, as used by clusters of varying size
+  const std::vector<double> radii{0.7, 1.5, 3.2};
+  Index                     serialIndex(mesh);
+  Index                     concurrentIndex(mesh);
+  concurrentIndex.buildVertexGrids(radii);
+  // The grids of this index are built by the concurrent queries
+  Index lazyIndex(mesh);
+
+  std::vector<std::vector<VertexID>> matches(mesh->nVertices() * radii.size());
+  std::vector<std::vector<VertexID>> lazyMatches(matches.size());
+  precice::utils::parallelForChunks(matches.size(), 4, [&](std::size_t, std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      matches[i]     = concurrentIndex.getVerticesInsideBox(mesh->vertex(i / radii.size()), radii[i % radii.size()]);
+      lazyMatches[i] = lazyIndex.getVerticesInsideBox(mesh->vertex(i / radii.size()), radii[i % radii.size()]);
+    }
+  });
+  for (std::size_t i = 0; i < matches.size(); ++i) {
+    const auto expected = serialIndex.getVerticesInsideBox(mesh->vertex(i / radii.size()), radii[i % radii.size()]);
+    BOOST_TEST(matches[i] == expected);
+    BOOST_TEST(lazyMatches[i] == expected);
+  }
+}
+
 /// Resembles how boost geometry is used inside the PetRBF
 BOOST_AUTO_TEST_CASE(QueryWithBoxEmpty)
 {
@@ -459,6 +566,33 @@ BOOST_AUTO_TEST_CASE(ProjectionToTriangle)
   }
 }
 
+BOOST_AUTO_TEST_CASE(ProjectionBatch)
+{
+  PRECICE_TEST(1_rank);
+  auto  meshPtr = fullMesh();
+  Index indexTree(meshPtr);
+
+  // Locations projecting to a triangle, an edge and a vertex
+  Eigen::MatrixXd locations(3, 3);
+  locations.col(0) << 1.0, 1.0, 0.1;
+  locations.col(1) << 2.5, 1.0, 0.0;
+  locations.col(2) << -1.0, 3.0, 0.0;
+
+  auto matches = indexTree.findNearestProjectionBatch(locations, 2);
+  BOOST_TEST_REQUIRE(matches.size() == 3);
+  for (int i = 0; i < 3; ++i) {
+    auto expected = indexTree.findNearestProjection(locations.col(i), 2);
+    BOOST_TEST(matches[i].polation.distance() == expected.polation.distance());
+    BOOST_TEST_REQUIRE(matches[i].polation.getWeightedElements().size() == expected.polation.getWeightedElements().size());
+    for (std::size_t k = 0; k < expected.polation.getWeightedElements().size(); ++k) {
+      BOOST_TEST(matches[i].polation.getWeightedElements()[k].vertexID == expected.polation.getWeightedElements()[k].vertexID);
+      BOOST_TEST(matches[i].polation.getWeightedElements()[k].weight == expected.polation.getWeightedElements()[k].weight);
+    }
+  }
+
+  BOOST_TEST(indexTree.findNearestProjectionBatch(Eigen::MatrixXd(3, 0), 2).empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Projection
 
 BOOST_AUTO_TEST_SUITE(Tetrahedra)
@@ -562,5 +696,117 @@ BOOST_AUTO_TEST_CASE(TetraWorksOnBoundary)
 
 BOOST_AUTO_TEST_SUITE_END() // Tetrahedra
 
+BOOST_AUTO_TEST_SUITE(Update)
+
+namespace {
+/// Creates the first count vertices of a 20 x 20 grid, where the vertices of the given indices are shifted
+void createShiftedGrid(Mesh &mesh, const std::set<int> &shifted, int count = 400)
+{
+  for (int i = 0; i < count; ++i) {
+    const double shift = shifted.count(i) ? 0.4 : 0.0;
+    mesh.createVertex(Eigen::Vector3d(i / 20 + shift, i % 20 + shift, 0));
+  }
+}
+
+/// Compares the index to a brute-force search of the closest vertex
+void checkClosestVertices(Mesh &mesh)
+{
+  for (double x = -0.5; x < 20; x += 0.7) {
+    for (double y = -0.5; y < 20; y += 0.7) {
+      const Eigen::Vector3d location(x, y, 0.1);
+      double                expected = std::numeric_limits<double>::max();
+      for (const auto &vertex : mesh.vertices()) {
+        expected = std::min(expected, (vertex.getCoords() - location).norm());
+      }
+      const auto match = mesh.index().getClosestVertex(location).index;
+      BOOST_TEST((mesh.vertex(match).getCoords() - location).norm() == expected);
+    }
+  }
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(RemeshVertices)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh("MyMesh", 3, testing::nextMeshID());
+  createShiftedGrid(mesh, {});
+  checkClosestVertices(mesh);
+
+  // Few changes are updated in place: moved vertices, removed vertices and added vertices
+  mesh.reset();
+  createShiftedGrid(mesh, {3, 77}, 395);
+  BOOST_TEST(mesh.nVertices() == 395);
+  checkClosestVertices(mesh);
+
+  mesh.reset();
+  createShiftedGrid(mesh, {3, 150});
+  checkClosestVertices(mesh);
+
+  // Many changes rebuild the tree
+  std::set<int> shifted;
+  for (int i = 0; i < 400; i += 2) {
+    shifted.insert(i);
+  }
+  mesh.reset();
+  createShiftedGrid(mesh, shifted);
+  checkClosestVertices(mesh);
+
+  auto inside = mesh.index().getVerticesInsideBox(mesh::BoundingBox({-1, 0.3, -1, 0.3, -1, 1}));
+  BOOST_TEST(inside.empty());
+  inside = mesh.index().getVerticesInsideBox(mesh::BoundingBox({0.9, 1.5, 0.9, 1.5, -1, 1}));
+  BOOST_TEST(inside == std::vector<VertexID>{21});
+}
+
+BOOST_AUTO_TEST_CASE(ReorderedVertices)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh("MyMesh", 3, testing::nextMeshID());
+  createShiftedGrid(mesh, {});
+  checkClosestVertices(mesh);
+
+  // Swapping two vertices moves both of them to the old geometry of the other one
+  mesh.reset();
+  for (int i = 0; i < 400; ++i) {
+    const int j = i == 5 ? 230 : (i == 230 ? 5 : i);
+    mesh.createVertex(Eigen::Vector3d(j / 20, j % 20, 0));
+  }
+  checkClosestVertices(mesh);
+  BOOST_TEST(mesh.index().getClosestVertex(Eigen::Vector3d(0, 5, 0)).index == 230);
+}
+
+BOOST_AUTO_TEST_CASE(ClearAfterRemesh)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh("MyMesh", 3, testing::nextMeshID());
+  createShiftedGrid(mesh, {});
+  checkClosestVertices(mesh);
+
+  // Clearing releases the index, which is rebuilt for the new mesh
+  mesh.clear();
+  createShiftedGrid(mesh, {3, 77}, 200);
+  checkClosestVertices(mesh);
+}
+
+BOOST_AUTO_TEST_CASE(MovedTriangles)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh mesh = fullMesh();
+  Index   indexTree(mesh);
+
+  const Eigen::Vector3d location(5, 5, 0);
+  const auto            before = indexTree.findNearestProjection(location, 2);
+  BOOST_TEST(before.polation.distance() > 4.0);
+
+  // Move a vertex close to the location, which moves its edges and triangles
+  mesh->vertex(2).setCoords(Eigen::Vector3d(5, 3, 0));
+  indexTree.markOutdated();
+
+  BOOST_TEST(indexTree.getClosestVertex(location).index == 2);
+  const auto after = indexTree.findNearestProjection(location, 2);
+  BOOST_TEST(after.polation.distance() <= 2.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Update
+
 BOOST_AUTO_TEST_SUITE_END() // Mesh
 BOOST_AUTO_TEST_SUITE_END() // Query
@@ -0,0 +1,140 @@
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <vector>
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "query/Index.hpp"
+#include "query/impl/VertexGrid.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::query;
+using impl::VertexGrid;
+
+namespace {
+
+using Point = VertexGrid::Point;
+
+/// Random points in the unit cube, which are flat in z for 2D
+std::vector<Point> randomPoints(std::size_t n, int dimensions)
+{
+  std::mt19937                           generator(42);
+  std::uniform_real_distribution<double> coordinate(0.0, 1.0);
+
+  std::vector<Point> points(n, Point{0, 0, 0});
+  for (auto &point : points) {
+    for (int d = 0; d < dimensions; ++d) {
+      point[d] = coordinate(generator);
+    }
+  }
+  return points;
+}
+
+std::set<std::size_t> insideSphere(const VertexGrid &grid, const Point &center, double radius)
+{
+  std::set<std::size_t> matches;
+  grid.visitInsideSphere(center, radius, [&](std::size_t item) {
+    matches.insert(item);
+    return false;
+  });
+  return matches;
+}
+
+std::set<std::size_t> bruteForce(const std::vector<Point> &points, const Point &center, double radius)
+{
+  std::set<std::size_t> matches;
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const double distance = std::sqrt(std::pow(points[i][0] - center[0], 2) + std::pow(points[i][1] - center[1], 2) + std::pow(points[i][2] - center[2], 2));
+    if (distance < radius) {
+      matches.insert(i);
+    }
+  }
+  return matches;
+}
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(QueryTests)
+BOOST_AUTO_TEST_SUITE(VertexGridTests)
+
+BOOST_AUTO_TEST_CASE(Empty)
+{
+  PRECICE_TEST(1_rank);
+  VertexGrid grid({}, 0.1);
+  BOOST_TEST(grid.empty());
+  BOOST_TEST(insideSphere(grid, {0, 0, 0}, 1.0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(Cells)
+{
+  PRECICE_TEST(1_rank);
+  const std::vector<Point> points{{0, 0, 0}, {1, 0.5, 0}, {0.25, 0.25, 0}};
+  VertexGrid               grid(points, 0.5);
+  BOOST_TEST(grid.size() == 3);
+  // The upper bound lies in an additional cell, the flat dimension has a single cell
+  BOOST_TEST(grid.cellCount() == 3 * 2 * 1);
+  BOOST_TEST(VertexGrid::requiredCells({1, 0.5, 0}, 0.5) == 6.0);
+
+  BOOST_TEST(insideSphere(grid, {0, 0, 0}, 0.5) == (std::set<std::size_t>{0, 2}));
+  // The boundary of the sphere is exclusive
+  BOOST_TEST(insideSphere(grid, {1, 0, 0}, 0.5).empty());
+  BOOST_TEST(insideSphere(grid, {5, 5, 5}, 1.0).empty());
+  BOOST_TEST(insideSphere(grid, {0, 0, 0}, 0.0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(RandomPoints)
+{
+  PRECICE_TEST(1_rank);
+  for (int dimensions : {2, 3}) {
+    const auto points = randomPoints(2000, dimensions);
+    for (double cellWidth : {0.05, 0.3, 2.0}) {
+      const VertexGrid grid(points, cellWidth);
+      for (const Point &center : {Point{0.5, 0.5, 0}, Point{0.01, 0.99, 0.5}, Point{-0.1, 0.5, 0.5}}) {
+        for (double radius : {0.01, 0.05, 0.2, 10.0}) {
+          BOOST_TEST(insideSphere(grid, center, radius) == bruteForce(points, center, radius));
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(StopVisit)
+{
+  PRECICE_TEST(1_rank);
+  const VertexGrid grid(randomPoints(100, 3), 0.1);
+  std::size_t      visited = 0;
+  BOOST_TEST(grid.visitInsideSphere({0.5, 0.5, 0.5}, 2.0, [&](std::size_t) { return ++visited > 0; }));
+  BOOST_TEST(visited == 1);
+}
+
+BOOST_AUTO_TEST_CASE(IndexRadii)
+{
+  PRECICE_TEST(1_rank);
+  const auto points = randomPoints(500, 3);
+  mesh::Mesh mesh("MyMesh", 3, testing::nextMeshID());
+  for (const auto &point : points) {
+    mesh.createVertex(Eigen::Vector3d(point[0], point[1], point[2]));
+  }
+
+  // Radii of different grids, including tiny ones which exceed the bound of cells
+  mesh::Vertex center(Eigen::Vector3d(0.3, 0.6, 0.5), -1);
+  for (double radius : {1e-6, 0.01, 0.1, 0.15, 0.7, 100.0}) {
+    const auto expected = bruteForce(points, center.rawCoords(), radius);
+    const auto matches  = mesh.index().getVerticesInsideBox(center, radius);
+    BOOST_TEST(std::set<std::size_t>(matches.begin(), matches.end()) == expected);
+    BOOST_TEST(matches.size() == expected.size());
+    BOOST_TEST(mesh.index().isAnyVertexInsideBox(center, radius) == !expected.empty());
+
+    const auto batch = mesh.index().getVerticesInsideBoxBatch(Eigen::Vector3d(0.3, 0.6, 0.5), radius);
+    BOOST_TEST(batch.size() == 1);
+    BOOST_TEST(std::set<std::size_t>(batch.ids.begin(), batch.ids.end()) == expected);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // VertexGridTests
+BOOST_AUTO_TEST_SUITE_END() // QueryTests
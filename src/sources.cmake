@@ -191,6 +191,8 @@ target_sources(preciceCore
     src/mapping/NearestNeighborMapping.hpp
     src/mapping/NearestProjectionMapping.cpp
     src/mapping/NearestProjectionMapping.hpp
+    src/mapping/OperatorRegistry.cpp
+    src/mapping/OperatorRegistry.hpp
     src/mapping/PartitionOfUnityMapping.hpp
     src/mapping/PetRadialBasisFctMapping.hpp
     src/mapping/Polation.cpp
@@ -206,6 +208,10 @@ target_sources(preciceCore
     src/mapping/config/MappingConfigurationTypes.hpp
     src/mapping/impl/BasisFunctions.hpp
     src/mapping/impl/CreateClustering.hpp
+    src/mapping/impl/HierarchicalMatrix.cpp
+    src/mapping/impl/HierarchicalMatrix.hpp
+    src/mapping/impl/OperatorCache.cpp
+    src/mapping/impl/OperatorCache.hpp
     src/mapping/impl/SphericalVertexCluster.hpp
     src/math/Bspline.cpp
     src/math/Bspline.hpp
@@ -288,7 +294,13 @@ target_sources(preciceCore
     src/profiling/config/ProfilingConfiguration.hpp
     src/query/Index.cpp
     src/query/Index.hpp
+    src/query/impl/MortonOrder.cpp
+    src/query/impl/MortonOrder.hpp
+    src/query/impl/PackedRTree.cpp
+    src/query/impl/PackedRTree.hpp
     src/query/impl/RTreeAdapter.hpp
+    src/query/impl/VertexGrid.cpp
+    src/query/impl/VertexGrid.hpp
     src/time/Sample.hpp
     src/time/Stample.hpp
     src/time/Storage.cpp
@@ -322,6 +334,8 @@ target_sources(preciceCore
     src/utils/String.hpp
     src/utils/TableWriter.cpp
     src/utils/TableWriter.hpp
+    src/utils/Threading.cpp
+    src/utils/Threading.hpp
     src/utils/TypeNames.hpp
     src/utils/algorithm.hpp
     src/utils/assertion.hpp
@@ -44,6 +44,7 @@ target_sources(testprecice
     src/m2n/tests/PointToPointCommunicationTest.cpp
     src/mapping/tests/AxialGeoMultiscaleMappingTest.cpp
     src/mapping/tests/GinkgoRadialBasisFctSolverTest.cpp
+    src/mapping/tests/HierarchicalMatrixTest.cpp
     src/mapping/tests/LinearCellInterpolationMappingTest.cpp
     src/mapping/tests/MappingConfigurationTest.cpp
     src/mapping/tests/NearestNeighborGradientMappingTest.cpp
@@ -80,8 +81,10 @@ target_sources(testprecice
     src/precice/tests/VersioningTests.cpp
     src/precice/tests/WatchIntegralTest.cpp
     src/precice/tests/WatchPointTest.cpp
+    src/query/tests/PackedRTreeTests.cpp
     src/query/tests/RTreeAdapterTests.cpp
     src/query/tests/RTreeTests.cpp
+    src/query/tests/VertexGridTests.cpp
     src/testing/DataContextFixture.cpp
     src/testing/DataContextFixture.hpp
     src/testing/GlobalFixtures.cpp
@@ -108,6 +111,7 @@ target_sources(testprecice
     src/utils/tests/ParallelTest.cpp
     src/utils/tests/StatisticsTest.cpp
     src/utils/tests/StringTest.cpp
+    src/utils/tests/ThreadingTest.cpp
     src/xml/tests/ParserTest.cpp
     src/xml/tests/PrinterTest.cpp
     src/xml/tests/XMLTest.cpp
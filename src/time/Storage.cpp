@@ -1,4 +1,5 @@
 #include <boost/range.hpp>
+#include <deque>
 
 #include "cplscheme/CouplingScheme.hpp"
 #include "math/Bspline.hpp"
@@ -9,6 +10,29 @@
 
 namespace precice::time {
 
+namespace {
+
+/// Interpolation weights for given timestamps, interpolation degree and sampling time
+struct CachedWeights {
+  std::vector<double> times;
+  int                 degree;
+  double              time;
+  Eigen::VectorXd     weights;
+};
+
+/**
+ * @brief Interpolation weights shared by all Storages
+ *
+ * All data exchanged in a time window is stored at the same timestamps and sampled at the same times.
+ * Hence, the weights only need to be computed once for all Storages.
+ * Only few distinct sampling times are used per window, so a small cache suffices.
+ */
+thread_local std::deque<CachedWeights> weightsCache;
+
+constexpr std::size_t maxCachedWeights = 32;
+
+} // namespace
+
 Storage::Storage()
     : _stampleStorage{}, _degree(0)
 {
@@ -26,11 +50,8 @@ Storage &Storage::operator=(const Storage &other)
 
 void Storage::setSampleAtTime(double time, const Sample &sample)
 {
-  // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
-
   if (_stampleStorage.empty()) {
-    _stampleStorage.emplace_back(Stample{time, sample});
+    appendStample(time, sample);
     return;
   }
 
@@ -42,7 +63,7 @@ void Storage::setSampleAtTime(double time, const Sample &sample)
   auto existingSample = std::find_if(_stampleStorage.begin(), _stampleStorage.end(), [&time](const auto &s) { return math::equals(s.timestamp, time); });
   if (existingSample == _stampleStorage.end()) { // key does not exist yet
     PRECICE_ASSERT(math::smaller(maxStoredTime(), time), maxStoredTime(), time, "Trying to write sample with a time that is too small. Please use clear(), if you want to write new samples to the storage.");
-    _stampleStorage.emplace_back(Stample{time, sample});
+    appendStample(time, sample);
   } else {
     // Overriding sample
     existingSample->sample = sample;
@@ -53,9 +74,6 @@ void Storage::setInterpolationDegree(int interpolationDegree)
 {
   PRECICE_ASSERT(interpolationDegree >= Time::MIN_WAVEFORM_DEGREE);
   _degree = interpolationDegree;
-
-  // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
 }
 
 int Storage::getInterpolationDegree() const
@@ -88,32 +106,23 @@ void Storage::move()
   PRECICE_ASSERT(nTimes() >= 2, "Calling Storage::move() is only allowed, if there is a sample at the beginning and at the end. This ensures that this function is only called at the end of the window.", getTimes());
   PRECICE_ASSERT(!_stampleStorage.empty(), "Storage does not contain any data!");
   const double nextWindowStart = _stampleStorage.back().timestamp;
-  _stampleStorage.erase(_stampleStorage.begin(), --_stampleStorage.end());
+  recycle(_stampleStorage.begin(), --_stampleStorage.end());
   PRECICE_ASSERT(nextWindowStart == _stampleStorage.front().timestamp);
-
-  // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
 }
 
 void Storage::trim()
 {
   PRECICE_ASSERT(!_stampleStorage.empty(), "Storage does not contain any data!");
   const double thisWindowStart = _stampleStorage.front().timestamp;
-  _stampleStorage.erase(++_stampleStorage.begin(), _stampleStorage.end());
+  recycle(++_stampleStorage.begin(), _stampleStorage.end());
   PRECICE_ASSERT(_stampleStorage.size() == 1);
   PRECICE_ASSERT(thisWindowStart == _stampleStorage.front().timestamp);
-
-  // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
 }
 
 void Storage::clear()
 {
-  _stampleStorage.clear();
+  recycle(_stampleStorage.begin(), _stampleStorage.end());
   PRECICE_ASSERT(_stampleStorage.size() == 0);
-
-  // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
 }
 
 void Storage::clearExceptLast()
@@ -121,31 +130,47 @@ void Storage::clearExceptLast()
   if (_stampleStorage.empty()) {
     return;
   }
-  _stampleStorage.erase(_stampleStorage.begin(), --_stampleStorage.end());
-
-  // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
+  recycle(_stampleStorage.begin(), --_stampleStorage.end());
 }
 
 void Storage::trimBefore(double time)
 {
+  // Stamples are sorted by time, hence the stamples before time form a prefix
   auto beforeTime = [time](const auto &s) { return math::smaller(s.timestamp, time); };
-  _stampleStorage.erase(std::remove_if(_stampleStorage.begin(), _stampleStorage.end(), beforeTime), _stampleStorage.end());
-
-  // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
+  recycle(_stampleStorage.begin(), std::find_if_not(_stampleStorage.begin(), _stampleStorage.end(), beforeTime));
 }
 
 void Storage::trimAfter(double time)
 {
+  // Stamples are sorted by time, hence the stamples after time form a suffix
   auto afterTime = [time](const auto &s) { return math::greater(s.timestamp, time); };
-  _stampleStorage.erase(std::remove_if(_stampleStorage.begin(), _stampleStorage.end(), afterTime), _stampleStorage.end());
+  recycle(std::find_if(_stampleStorage.begin(), _stampleStorage.end(), afterTime), _stampleStorage.end());
+}
+
+void Storage::appendStample(double time, const Sample &sample)
+{
+  if (_recycledSamples.empty()) {
+    _stampleStorage.emplace_back(Stample{time, sample});
+    return;
+  }
 
-  // The spline has to be recomputed, since the underlying data has changed
-  _bspline.reset();
+  // Copy assignment keeps the buffers of the recycled sample if the sizes match
+  Sample recycled = std::move(_recycledSamples.back());
+  _recycledSamples.pop_back();
+  recycled = sample;
+  _stampleStorage.emplace_back(Stample{time, std::move(recycled)});
 }
 
-Sample Storage::getSampleAtOrAfter(double before) const
+void Storage::recycle(std::vector<Stample>::iterator first, std::vector<Stample>::iterator last)
+{
+  // Moving the samples out leaves empty samples behind, which makes the erase below free of deallocations
+  for (auto iter = first; iter != last; ++iter) {
+    _recycledSamples.push_back(std::move(iter->sample));
+  }
+  _stampleStorage.erase(first, last);
+}
+
+const Sample &Storage::getSampleAtOrAfter(double before) const
 {
   PRECICE_TRACE(before);
   if (nTimes() == 1) {
@@ -205,13 +230,56 @@ Eigen::VectorXd Storage::sample(double time) const
     return _stampleStorage[i].sample.values; // don't use getTimesAndValues, because this would iterate over the complete _stampleStorage.
   }
 
-  //Create a new bspline if _bspline does not already contain a spline
-  if (!_bspline.has_value()) {
-    auto [times, values] = getTimesAndValues();
-    _bspline.emplace(times, values, usedDegree);
+  const Eigen::VectorXd &weights = interpolationWeights(time, usedDegree);
+
+  Eigen::VectorXd result = weights[0] * _stampleStorage[0].sample.values;
+  for (int j = 1; j < nTimes(); ++j) {
+    result += weights[j] * _stampleStorage[j].sample.values;
+  }
+  return result;
+}
+
+void Storage::sample(double time, ::precice::span<const int> vertices, ::precice::span<double> values) const
+{
+  PRECICE_ASSERT(this->nTimes() != 0, "There are no samples available");
+  const int dataDims = _stampleStorage.front().sample.dataDims;
+  PRECICE_ASSERT(values.size() == vertices.size() * dataDims, values.size(), vertices.size(), dataDims);
+
+  auto gatherFrom = [&](const Eigen::VectorXd &source) {
+    Eigen::Map<const Eigen::MatrixXd> sourceData(source.data(), dataDims, source.size() / dataDims);
+    Eigen::Map<Eigen::MatrixXd>       outputData(values.data(), dataDims, vertices.size());
+    for (int i = 0; i < static_cast<int>(vertices.size()); ++i) {
+      outputData.col(i) = sourceData.col(vertices[i]);
+    }
+  };
+
+  const int usedDegree = computeUsedDegree(_degree, nTimes());
+
+  if (usedDegree == 0) {
+    gatherFrom(this->getSampleAtOrAfter(time).values);
+    return;
+  }
+
+  PRECICE_ASSERT(usedDegree >= 1);
+
+  //Use the sample corresponding to time if it exists
+  const int i = findTimeId(time);
+  if (i > -1) {
+    gatherFrom(_stampleStorage[i].sample.values);
+    return;
   }
 
-  return _bspline.value().interpolateAt(time);
+  const Eigen::VectorXd &weights = interpolationWeights(time, usedDegree);
+
+  Eigen::Map<Eigen::MatrixXd> outputData(values.data(), dataDims, vertices.size());
+  outputData.setZero();
+  for (int j = 0; j < nTimes(); ++j) {
+    const auto &                      source = _stampleStorage[j].sample.values;
+    Eigen::Map<const Eigen::MatrixXd> sourceData(source.data(), dataDims, source.size() / dataDims);
+    for (int i = 0; i < static_cast<int>(vertices.size()); ++i) {
+      outputData.col(i) += weights[j] * sourceData.col(vertices[i]);
+    }
+  }
 }
 
 Eigen::MatrixXd Storage::sampleGradients(double time) const
@@ -226,6 +294,26 @@ Eigen::MatrixXd Storage::sampleGradients(double time) const
   return this->getSampleAtOrAfter(time).gradients;
 }
 
+const Eigen::VectorXd &Storage::interpolationWeights(double time, int usedDegree) const
+{
+  auto matches = [&](const CachedWeights &entry) {
+    return entry.degree == usedDegree && entry.time == time &&
+           std::equal(entry.times.begin(), entry.times.end(), _stampleStorage.begin(), _stampleStorage.end(),
+                      [](double t, const Stample &stample) { return t == stample.timestamp; });
+  };
+  if (auto cached = std::find_if(weightsCache.begin(), weightsCache.end(), matches); cached != weightsCache.end()) {
+    return cached->weights;
+  }
+
+  if (weightsCache.size() == maxCachedWeights) {
+    weightsCache.pop_front();
+  }
+
+  const Eigen::VectorXd times = getTimes();
+  weightsCache.push_back(CachedWeights{{times.begin(), times.end()}, usedDegree, time, math::Bspline::computeWeights(times, usedDegree, time)});
+  return weightsCache.back().weights;
+}
+
 int Storage::computeUsedDegree(int requestedDegree, int numberOfAvailableSamples) const
 {
   return std::min(requestedDegree, numberOfAvailableSamples - 1);
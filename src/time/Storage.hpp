@@ -2,9 +2,8 @@
 
 #include <Eigen/Core>
 #include <boost/range.hpp>
-#include <optional>
 #include "logging/Logger.hpp"
-#include "math/Bspline.hpp"
+#include "precice/span.hpp"
 #include "time/Stample.hpp"
 
 namespace precice::time {
@@ -58,7 +57,7 @@ public:
    * @param before a double, where we want to find a normalized dt that comes directly after this one
    * @return Sample in this Storage at or directly after "before"
    */
-  Sample getSampleAtOrAfter(double before) const;
+  const Sample &getSampleAtOrAfter(double before) const;
 
   /**
    * @brief Get all normalized dts stored in this Storage sorted ascending.
@@ -136,18 +135,31 @@ public:
   */
   Eigen::VectorXd sample(double time) const;
 
+  /**
+   * @brief Samples the Storage at the given time for a subset of vertices
+   *
+   * Same as sample(double), but only evaluates the values of the given vertices and writes them directly into values.
+   * The cost is proportional to the amount of requested vertices instead of the size of the mesh.
+   *
+   * @param time a double, where we want to sample the waveform
+   * @param vertices the ids of the vertices to sample
+   * @param values the buffer receiving the sampled values, needs to be of size vertices.size() * dataDims
+   */
+  void sample(double time, ::precice::span<const int> vertices, ::precice::span<double> values) const;
+
   Eigen::MatrixXd sampleGradients(double time) const;
 
 private:
   /// Stores Stamples on the current window
   std::vector<Stample> _stampleStorage;
 
+  /// Samples of removed Stamples, their buffers are reused when storing new samples to avoid allocations in steady state
+  std::vector<Sample> _recycledSamples;
+
   mutable logging::Logger _log{"time::Storage"};
 
   int _degree;
 
-  mutable std::optional<math::Bspline> _bspline;
-
   /**
    * @brief Computes which degree may be used for interpolation.
    *
@@ -160,11 +172,28 @@ private:
    */
   int computeUsedDegree(int requestedDegree, int numberOfAvailableSamples) const;
 
+  /**
+   * @brief Returns the weights of the B-spline interpolation of the stored samples at the given time
+   *
+   * The weights only depend on the stored timestamps, the degree and the time. They are cached and shared between all Storages with identical timestamps.
+   *
+   * @param time the time where we want to sample the waveform
+   * @param usedDegree the B-spline degree used for interpolation
+   * @return weights w such that the interpolant is the weighted sum of the stored samples
+   */
+  const Eigen::VectorXd &interpolationWeights(double time, int usedDegree) const;
+
   time::Sample getSampleAtBeginning();
 
   time::Sample getSampleAtEnd();
 
   int findTimeId(double time) const;
+
+  /// Appends a Stample at the end of the Storage reusing the buffers of a recycled sample if available
+  void appendStample(double time, const Sample &sample);
+
+  /// Removes the given range of Stamples from the Storage and keeps their samples for reuse
+  void recycle(std::vector<Stample>::iterator first, std::vector<Stample>::iterator last);
 };
 
 } // namespace precice::time
@@ -27,4 +27,9 @@ Eigen::VectorXd Waveform::sample(double time) const
 {
   return _timeStepsStorage.sample(time);
 }
+
+void Waveform::sample(double time, ::precice::span<const int> vertices, ::precice::span<double> values) const
+{
+  _timeStepsStorage.sample(time, vertices, values);
+}
 } // namespace precice::time
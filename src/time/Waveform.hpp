@@ -54,6 +54,15 @@ public:
    */
   Eigen::VectorXd sample(const double time) const;
 
+  /**
+   * @brief Evaluate waveform at specific point in time for a subset of vertices.
+   *
+   * @param time Time where the sampling inside the window happens.
+   * @param vertices Ids of the vertices to sample.
+   * @param values Buffer receiving the values of Waveform at given time for the given vertices.
+   */
+  void sample(const double time, ::precice::span<const int> vertices, ::precice::span<double> values) const;
+
 private:
   /// Stores time steps in the current time window
   time::Storage _timeStepsStorage;
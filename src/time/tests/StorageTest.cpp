@@ -103,6 +103,64 @@ BOOST_AUTO_TEST_CASE(testGetTimesAndValues)
   }
 }
 
+// reuse the buffers of removed samples when storing new samples
+BOOST_AUTO_TEST_CASE(testReuseBuffers)
+{
+  PRECICE_TEST(1_rank);
+  auto storage = Storage();
+  int  nValues = 3;
+  storage.setSampleAtTime(0.0, time::Sample{1, Eigen::VectorXd::Zero(nValues)});
+  storage.setSampleAtTime(0.5, time::Sample{1, Eigen::VectorXd::Ones(nValues)});
+  storage.setSampleAtTime(1.0, time::Sample{1, 2 * Eigen::VectorXd::Ones(nValues)});
+  const double *buffer = storage.stamples().back().sample.values.data();
+
+  storage.trim();
+  BOOST_TEST(storage.nTimes() == 1);
+  storage.setSampleAtTime(1.0, time::Sample{1, 3 * Eigen::VectorXd::Ones(nValues)});
+  BOOST_TEST(storage.nTimes() == 2);
+  BOOST_TEST(storage.stamples().back().sample.values.data() == buffer);
+  for (int i = 0; i < nValues; i++) {
+    BOOST_TEST(storage.getSampleAtOrAfter(0.0).values(i) == 0);
+    BOOST_TEST(storage.getSampleAtOrAfter(1.0).values(i) == 3);
+  }
+
+  storage.move();
+  BOOST_TEST(storage.nTimes() == 1);
+  BOOST_TEST(storage.maxStoredTime() == 1.0);
+  storage.setSampleAtTime(2.0, time::Sample{1, 4 * Eigen::VectorXd::Ones(nValues)});
+  BOOST_TEST(storage.nTimes() == 2);
+  for (int i = 0; i < nValues; i++) {
+    BOOST_TEST(storage.getSampleAtOrAfter(1.0).values(i) == 3);
+    BOOST_TEST(storage.getSampleAtOrAfter(2.0).values(i) == 4);
+  }
+}
+
+// sample a subset of vertices and compare against sampling the complete storage
+BOOST_AUTO_TEST_CASE(testSampleVertexSubset)
+{
+  PRECICE_TEST(1_rank);
+  const int dataDims  = 2;
+  const int nVertices = 4;
+  auto      storage   = Storage();
+  storage.setInterpolationDegree(2);
+  storage.setSampleAtTime(0.0, time::Sample{dataDims, Eigen::VectorXd::LinSpaced(dataDims * nVertices, 0, 7)});
+  storage.setSampleAtTime(0.5, time::Sample{dataDims, Eigen::VectorXd::LinSpaced(dataDims * nVertices, 2, 16)});
+  storage.setSampleAtTime(1.0, time::Sample{dataDims, Eigen::VectorXd::LinSpaced(dataDims * nVertices, -3, 4)});
+
+  const std::vector<int> vertices{3, 0, 2};
+  std::vector<double>    values(vertices.size() * dataDims);
+
+  for (double t : {0.0, 0.25, 0.5, 0.8, 1.0}) {
+    const Eigen::VectorXd expected = storage.sample(t);
+    storage.sample(t, vertices, values);
+    for (std::size_t i = 0; i < vertices.size(); ++i) {
+      for (int c = 0; c < dataDims; ++c) {
+        BOOST_TEST(testing::equals(values[i * dataDims + c], expected[vertices[i] * dataDims + c]));
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE(ExtrapolationTests)
 BOOST_AUTO_TEST_CASE(testExtrapolateDataZerothOrder)
 {
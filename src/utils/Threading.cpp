@@ -0,0 +1,20 @@
+#include "utils/Threading.hpp"
+
+#include <algorithm>
+#include <thread>
+
+namespace precice::utils {
+
+std::size_t availableThreads()
+{
+  return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+std::size_t chunkCount(std::size_t n, std::size_t minChunkSize, std::size_t maxThreads)
+{
+  const std::size_t threads = (maxThreads == 0) ? availableThreads() : maxThreads;
+  const std::size_t chunks  = n / std::max<std::size_t>(minChunkSize, 1);
+  return std::clamp<std::size_t>(chunks, 1, threads);
+}
+
+} // namespace precice::utils
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "logging/Logger.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace utils {
+
+/// Returns the number of concurrent threads supported by the hardware, at least 1.
+std::size_t availableThreads();
+
+/**
+ * @brief Computes the amount of chunks used to process n items with parallelForChunks
+ *
+ * @param[in] n the amount of items to process
+ * @param[in] minChunkSize the minimal amount of items per chunk, which avoids spawning threads for small workloads
+ * @param[in] maxThreads the maximal amount of threads to use as configured by the caller, 0 uses availableThreads()
+ */
+std::size_t chunkCount(std::size_t n, std::size_t minChunkSize, std::size_t maxThreads);
+
+/**
+ * @brief Splits the range [0, n) into nChunks contiguous chunks and processes them concurrently
+ *
+ * The function is called as f(chunk, begin, end) once per chunk, where the first chunk is processed on the calling thread.
+ * The chunks are numbered, which allows to store per-chunk results and to reduce them in a deterministic order.
+ * Exceptions thrown by f are rethrown on the calling thread after all chunks have been processed.
+ * Loggers are not thread-safe, hence the other chunks defer their log records, which are emitted in chunk order after the join.
+ */
+template <typename Func>
+void parallelForChunks(std::size_t n, std::size_t nChunks, Func &&f)
+{
+  PRECICE_ASSERT(nChunks > 0);
+  const auto chunkBegin = [n, nChunks](std::size_t chunk) { return n * chunk / nChunks; };
+
+  if (nChunks == 1) {
+    f(std::size_t{0}, std::size_t{0}, n);
+    return;
+  }
+
+  std::vector<std::exception_ptr>                   errors(nChunks);
+  std::vector<std::vector<logging::DeferredRecord>> records(nChunks);
+  std::vector<std::thread>                          threads;
+  threads.reserve(nChunks - 1);
+  for (std::size_t chunk = 1; chunk < nChunks; ++chunk) {
+    threads.emplace_back([&, chunk] {
+      logging::DeferLogging defer(records[chunk]);
+      try {
+        f(chunk, chunkBegin(chunk), chunkBegin(chunk + 1));
+      } catch (...) {
+        errors[chunk] = std::current_exception();
+      }
+    });
+  }
+  try {
+    f(std::size_t{0}, std::size_t{0}, chunkBegin(1));
+  } catch (...) {
+    errors[0] = std::current_exception();
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (auto &chunkRecords : records) {
+    logging::emitDeferred(chunkRecords);
+  }
+  for (const auto &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+} // namespace utils
+} // namespace precice
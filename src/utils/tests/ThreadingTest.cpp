@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "logging/Logger.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Threading.hpp"
+
+using namespace precice;
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(ThreadingTests)
+
+BOOST_AUTO_TEST_CASE(ChunkCount)
+{
+  PRECICE_TEST(1_rank);
+  BOOST_TEST(chunkCount(0, 10, 4) == 1);
+  BOOST_TEST(chunkCount(9, 10, 4) == 1);
+  BOOST_TEST(chunkCount(25, 10, 4) == 2);
+  BOOST_TEST(chunkCount(1000, 10, 4) == 4);
+  BOOST_TEST(chunkCount(1000, 0, 3) == 3);
+  BOOST_TEST(chunkCount(1000, 1, 0) >= 1);
+  BOOST_TEST(chunkCount(1000, 1, 1) == 1);
+}
+
+BOOST_AUTO_TEST_CASE(CoversRange)
+{
+  PRECICE_TEST(1_rank);
+  const std::size_t n = 1001;
+  for (std::size_t nChunks : {1, 2, 3, 7}) {
+    std::vector<int>         visits(n, 0);
+    std::vector<std::size_t> sums(nChunks, 0);
+    parallelForChunks(n, nChunks, [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+      for (std::size_t i = begin; i < end; ++i) {
+        ++visits[i];
+        sums[chunk] += i;
+      }
+    });
+    BOOST_TEST(std::all_of(visits.begin(), visits.end(), [](int v) { return v == 1; }));
+    BOOST_TEST(std::accumulate(sums.begin(), sums.end(), std::size_t{0}) == n * (n - 1) / 2);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(RethrowsExceptions)
+{
+  PRECICE_TEST(1_rank);
+  auto throwInLastChunk = [](std::size_t chunk, std::size_t, std::size_t) {
+    if (chunk == 2) {
+      throw std::runtime_error("chunk failed");
+    }
+  };
+  BOOST_CHECK_THROW(parallelForChunks(10, 3, throwInLastChunk), std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(DeferredLogging)
+{
+  PRECICE_TEST(1_rank);
+  logging::Logger _log{"utils::ThreadingTest"};
+
+  std::vector<logging::DeferredRecord> records;
+  std::thread([&] {
+    logging::DeferLogging defer(records);
+    PRECICE_INFO("Deferred {}", 1);
+    PRECICE_WARN("Deferred {}", 2);
+  }).join();
+  BOOST_TEST_REQUIRE(records.size() == 2);
+  BOOST_TEST(records[0].module == "utils::ThreadingTest");
+  BOOST_TEST(records[0].message == "Deferred 1");
+  BOOST_TEST(records[1].message == "Deferred 2");
+
+  // Emitting from a deferring thread passes the records on
+  std::vector<logging::DeferredRecord> outer;
+  {
+    logging::DeferLogging defer(outer);
+    logging::emitDeferred(records);
+  }
+  BOOST_TEST(records.empty());
+  BOOST_TEST(outer.size() == 2);
+  logging::emitDeferred(outer);
+  BOOST_TEST(outer.empty());
+
+  // Chunks processed by other threads log concurrently
+  parallelForChunks(4, 4, [&](std::size_t chunk, std::size_t, std::size_t) {
+    PRECICE_INFO("Processing chunk {}", chunk);
+  });
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ThreadingTests
+BOOST_AUTO_TEST_SUITE_END() // UtilsTests